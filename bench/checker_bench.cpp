@@ -0,0 +1,455 @@
+/**
+ * @file checker_bench.cpp
+ * @brief 容差监控器热点路径基准套件
+ *
+ * 覆盖以下场景，结果以JSON输出到标准输出，便于跨版本跟踪：
+ * - check_throughput: 不同信号数量下监控循环每秒完成的信号检查次数，以及批量注册/移除耗时
+ * - registry_latency: 并发查询线程存在时registerSignal/removeSignal/getSignalState的延迟
+ * - c_api_overhead:   C接口相对C++接口的单次调用开销
+ * - callback_fanout:  一次性派发大量警告/故障回调的开销（直接调用与异步派发）
+ * - stats_overhead:   启用热点路径统计后每个样本的额外开销
+ * - state_snapshot:   全量刷新信号状态时逐个查询与批量快照的耗时
+ *
+ * 用法: ToleranceCheckerBench [--max-signals N] [--quick]
+ */
+
+#include "ToleranceChecker.h"
+#include "ToleranceChecker_c.h"
+#include "SignalHotStore.h"
+#include "LatencyHistogram.h"
+#include "Logger.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef TC_BENCH_VERSION
+#define TC_BENCH_VERSION "unknown"
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::size_t maxSignals{1000000};  ///< 吞吐场景的最大信号数量
+    bool quick{false};              ///< 缩短各场景的运行时间
+};
+
+/**
+ * @brief 延迟分布摘要（纳秒）
+ */
+struct Summary {
+    double p50{0.0};
+    double p99{0.0};
+    double max{0.0};
+    double mean{0.0};
+    std::size_t samples{0};
+};
+
+Summary summarize(std::vector<double>& values) {
+    Summary summary;
+    summary.samples = values.size();
+    if (values.empty()) {
+        return summary;
+    }
+    std::sort(values.begin(), values.end());
+    summary.p50 = values[values.size() / 2];
+    summary.p99 = values[std::min(values.size() - 1, values.size() * 99 / 100)];
+    summary.max = values.back();
+    double total = 0.0;
+    for (double value : values) {
+        total += value;
+    }
+    summary.mean = total / static_cast<double>(values.size());
+    return summary;
+}
+
+std::string toJson(const char* name, const Summary& summary) {
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+                  "\"%s\":{\"p50_ns\":%.1f,\"p99_ns\":%.1f,\"max_ns\":%.1f,\"mean_ns\":%.1f,\"samples\":%zu}",
+                  name, summary.p50, summary.p99, summary.max, summary.mean, summary.samples);
+    return buffer;
+}
+
+double elapsedNs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+std::string signalName(const char* prefix, std::size_t index) {
+    return std::string(prefix) + std::to_string(index);
+}
+
+SignalConfig quietConfig(int samplePeriodMs) {
+    SignalConfig config{};
+    config.targetValue = 50.0;
+    config.warningThreshold = 5.0;
+    config.faultThreshold = 10.0;
+    config.tcMs = 0;
+    config.tsMs = 0;
+    config.samplePeriodMs = samplePeriodMs;
+    config.valueCallback = [](const std::string&) { return 51.0; };
+    return config;
+}
+
+std::vector<SignalHandle> registerMany(ToleranceChecker& checker, const char* prefix, std::size_t count,
+                                       int samplePeriodMs) {
+    std::vector<SignalRegistration> signals;
+    signals.reserve(count);
+    const SignalConfig config = quietConfig(samplePeriodMs);
+    for (std::size_t i = 0; i < count; ++i) {
+        signals.emplace_back(signalName(prefix, i), config);
+    }
+    return checker.registerSignals(signals);
+}
+
+void removeMany(ToleranceChecker& checker, const std::vector<SignalHandle>& handles) {
+    checker.removeSignals(handles);
+}
+
+struct PassTotals {
+    std::uint64_t passes{0};
+    std::uint64_t checks{0};
+    std::uint64_t passUs{0};
+};
+
+PassTotals passTotals(const ToleranceChecker& checker) {
+    PassTotals totals;
+    for (const auto& stats : checker.getShardStats()) {
+        totals.passes += stats.passes;
+        totals.checks += stats.checks;
+        totals.passUs += stats.totalPassUs;
+    }
+    return totals;
+}
+
+// 场景1：监控循环的信号检查吞吐
+void benchCheckThroughput(const Options& options, std::vector<std::string>& results) {
+    auto& checker = ToleranceChecker::getInstance();
+    constexpr int kPeriodMs = 100;
+    const int rounds = options.quick ? 3 : 10;
+
+    for (std::size_t count = 1; count <= 1000000; count *= 10) {
+        char buffer[320];
+        if (count > options.maxSignals) {
+            std::snprintf(buffer, sizeof(buffer),
+                          "{\"case\":\"check_throughput\",\"signals\":%zu,\"skipped\":true}", count);
+            results.push_back(buffer);
+            continue;
+        }
+
+        auto registerStart = Clock::now();
+        auto handles = registerMany(checker, "throughput_", count, kPeriodMs);
+        double registerMs = elapsedNs(registerStart, Clock::now()) / 1e6;
+        // 等所有信号至少完成一次检查后再开始计量
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 * kPeriodMs));
+        PassTotals before = passTotals(checker);
+        std::this_thread::sleep_for(std::chrono::milliseconds(rounds * kPeriodMs));
+        PassTotals after = passTotals(checker);
+        auto removeStart = Clock::now();
+        removeMany(checker, handles);
+        double removeMs = elapsedNs(removeStart, Clock::now()) / 1e6;
+
+        std::uint64_t checks = after.checks - before.checks;
+        std::uint64_t passUs = after.passUs - before.passUs;
+        std::uint64_t passes = after.passes - before.passes;
+        double checksPerSec = passUs > 0 ? static_cast<double>(checks) * 1e6 / static_cast<double>(passUs) : 0.0;
+        std::snprintf(buffer, sizeof(buffer),
+                      "{\"case\":\"check_throughput\",\"signals\":%zu,\"checks\":%llu,\"passes\":%llu,"
+                      "\"pass_us_total\":%llu,\"checks_per_sec\":%.1f,\"ns_per_check\":%.1f,"
+                      "\"register_ms\":%.1f,\"remove_ms\":%.1f}",
+                      count, static_cast<unsigned long long>(checks), static_cast<unsigned long long>(passes),
+                      static_cast<unsigned long long>(passUs), checksPerSec,
+                      checks > 0 ? static_cast<double>(passUs) * 1e3 / static_cast<double>(checks) : 0.0,
+                      registerMs, removeMs);
+        results.push_back(buffer);
+    }
+}
+
+// 场景2：并发查询下的注册/移除/查询延迟
+void benchRegistryLatency(const Options& options, std::vector<std::string>& results) {
+    auto& checker = ToleranceChecker::getInstance();
+    constexpr std::size_t kPopulation = 1000;
+    constexpr int kReaders = 2;
+    const std::size_t operations = options.quick ? 100 : 500;
+
+    auto population = registerMany(checker, "population_", kPopulation, 100);
+
+    std::atomic<bool> running{true};
+    std::vector<std::vector<double>> readLatencies(kReaders);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < kReaders; ++r) {
+        readers.emplace_back([&, r] {
+            std::mt19937 rng(static_cast<unsigned>(r + 1));
+            std::uniform_int_distribution<std::size_t> pick(0, kPopulation - 1);
+            auto& samples = readLatencies[r];
+            while (running.load(std::memory_order_relaxed)) {
+                SignalHandle handle = population[pick(rng)];
+                auto start = Clock::now();
+                checker.getSignalState(handle);
+                samples.push_back(elapsedNs(start, Clock::now()));
+            }
+        });
+    }
+
+    std::vector<double> registerLatencies;
+    std::vector<double> removeLatencies;
+    for (std::size_t i = 0; i < operations; ++i) {
+        std::string id = signalName("churn_", i);
+        SignalConfig config = quietConfig(100);
+        auto start = Clock::now();
+        SignalHandle handle = checker.registerSignal(id, config);
+        auto registered = Clock::now();
+        checker.removeSignal(handle);
+        auto removed = Clock::now();
+        registerLatencies.push_back(elapsedNs(start, registered));
+        removeLatencies.push_back(elapsedNs(registered, removed));
+    }
+
+    running.store(false);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    removeMany(checker, population);
+
+    std::vector<double> allReads;
+    for (auto& samples : readLatencies) {
+        allReads.insert(allReads.end(), samples.begin(), samples.end());
+    }
+    char header[128];
+    std::snprintf(header, sizeof(header),
+                  "{\"case\":\"registry_latency\",\"population\":%zu,\"readers\":%d,", kPopulation, kReaders);
+    results.push_back(std::string(header) + toJson("register", summarize(registerLatencies)) + "," +
+                      toJson("remove", summarize(removeLatencies)) + "," +
+                      toJson("get_signal_state", summarize(allReads)) + "}");
+}
+
+template <typename Fn>
+double nsPerCall(std::size_t iterations, Fn&& call) {
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        call(i);
+    }
+    return elapsedNs(start, Clock::now()) / static_cast<double>(iterations);
+}
+
+// 场景3：C接口相对C++接口的开销
+void benchCApiOverhead(const Options& options, std::vector<std::string>& results) {
+    auto& checker = ToleranceChecker::getInstance();
+    const std::size_t iterations = options.quick ? 20000 : 200000;
+    const std::string id = "c_api_signal";
+    SignalHandle handle = checker.registerSignal(id, quietConfig(100));
+    const tc_handle_t cHandle = handle.toValue();
+
+    volatile int sink = 0;
+    struct Pair {
+        const char* name;
+        double cppNs;
+        double cNs;
+    };
+    std::vector<Pair> pairs;
+
+    pairs.push_back({"get_state_by_handle",
+                     nsPerCall(iterations, [&](std::size_t) { sink = sink + static_cast<int>(checker.getSignalState(handle)); }),
+                     nsPerCall(iterations, [&](std::size_t) {
+                         tc_signal_state_t state;
+                         tc_get_signal_state_by_handle(cHandle, &state);
+                         sink = sink + static_cast<int>(state);
+                     })});
+    pairs.push_back({"get_state_by_id",
+                     nsPerCall(iterations, [&](std::size_t) { sink = sink + static_cast<int>(checker.getSignalState(id)); }),
+                     nsPerCall(iterations, [&](std::size_t) {
+                         tc_signal_state_t state;
+                         tc_get_signal_state(id.c_str(), &state);
+                         sink = sink + static_cast<int>(state);
+                     })});
+    pairs.push_back({"push_value_by_handle",
+                     nsPerCall(iterations, [&](std::size_t i) {
+                         checker.pushValue(handle, static_cast<double>(i & 7), Clock::now(), PushMode::NEXT_TICK);
+                     }),
+                     nsPerCall(iterations, [&](std::size_t i) {
+                         tc_push_value_by_handle(cHandle, static_cast<double>(i & 7), 0, TC_PUSH_NEXT_TICK);
+                     })});
+    checker.removeSignal(handle);
+
+    for (const auto& pair : pairs) {
+        char buffer[256];
+        std::snprintf(buffer, sizeof(buffer),
+                      "{\"case\":\"c_api_overhead\",\"call\":\"%s\",\"iterations\":%zu,\"cpp_ns\":%.1f,"
+                      "\"c_ns\":%.1f,\"overhead_ns\":%.1f}",
+                      pair.name, iterations, pair.cppNs, pair.cNs, pair.cNs - pair.cppNs);
+        results.push_back(buffer);
+    }
+}
+
+// 场景4：回调扇出开销
+void benchCallbackFanout(const Options& options, std::vector<std::string>& results) {
+    std::vector<std::size_t> counts = {1, 100, 10000};
+    if (!options.quick) {
+        counts.push_back(100000);
+    }
+
+    for (unsigned threads : {0u, 1u, 2u}) {
+        for (std::size_t count : counts) {
+            std::atomic<std::size_t> delivered{0};
+            std::vector<std::shared_ptr<SignalInfo>> signals;
+            signals.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                auto signal = std::make_shared<SignalInfo>();
+                signal->signalId = signalName("fanout_", i);
+                signal->config.faultCallback = [&delivered](const std::string&, double) {
+                    delivered.fetch_add(1, std::memory_order_relaxed);
+                };
+                signals.push_back(std::move(signal));
+            }
+
+            CallbackDispatcher dispatcher;
+            dispatcher.start(threads, 1024, OverflowPolicy::BLOCK);
+            auto start = Clock::now();
+            for (auto& signal : signals) {
+                dispatcher.dispatch(*signal, SignalState::FAULT, 99.0);
+            }
+            auto submitted = Clock::now();
+            while (delivered.load(std::memory_order_relaxed) < count) {
+                std::this_thread::yield();
+            }
+            auto done = Clock::now();
+            dispatcher.stop();
+
+            char buffer[256];
+            std::snprintf(buffer, sizeof(buffer),
+                          "{\"case\":\"callback_fanout\",\"dispatch_threads\":%u,\"callbacks\":%zu,"
+                          "\"submit_ns_per_callback\":%.1f,\"delivered_us\":%.1f}",
+                          threads, count, elapsedNs(start, submitted) / static_cast<double>(count),
+                          elapsedNs(start, done) / 1e3);
+            results.push_back(buffer);
+        }
+    }
+}
+
+// 场景5：统计子系统的单样本开销
+void benchStatsOverhead(const Options& options, std::vector<std::string>& results) {
+    auto& checker = ToleranceChecker::getInstance();
+    constexpr std::size_t kSignals = 2000;
+    constexpr int kPeriodMs = 50;
+    const int rounds = options.quick ? 4 : 20;
+
+    // 微基准：一对时间戳读取加一次单写入者直方图记录
+    CycleClock::calibrate();
+    CompactLatencyHistogram histogram;
+    const std::size_t iterations = options.quick ? 200000 : 2000000;
+    double recordNs = nsPerCall(iterations, [&](std::size_t) {
+        std::uint64_t start = CycleClock::now();
+        histogram.recordExclusive(CycleClock::toNs(CycleClock::now() - start));
+    });
+
+    auto handles = registerMany(checker, "stats_", kSignals, kPeriodMs);
+    double nsPerCheck[2] = {0.0, 0.0};
+    for (int enabled = 0; enabled < 2; ++enabled) {
+        checker.enableStats(enabled != 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 * kPeriodMs));
+        PassTotals before = passTotals(checker);
+        std::this_thread::sleep_for(std::chrono::milliseconds(rounds * kPeriodMs));
+        PassTotals after = passTotals(checker);
+        std::uint64_t checks = after.checks - before.checks;
+        nsPerCheck[enabled] = checks > 0
+            ? static_cast<double>(after.passUs - before.passUs) * 1e3 / static_cast<double>(checks) : 0.0;
+    }
+    checker.enableStats(false);
+    removeMany(checker, handles);
+
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+                  "{\"case\":\"stats_overhead\",\"signals\":%zu,\"record_ns\":%.1f,"
+                  "\"ns_per_check_disabled\":%.1f,\"ns_per_check_enabled\":%.1f,\"overhead_ns\":%.1f}",
+                  kSignals, recordNs, nsPerCheck[0], nsPerCheck[1], nsPerCheck[1] - nsPerCheck[0]);
+    results.push_back(buffer);
+}
+
+// 场景6：全量状态刷新（逐个按ID查询与批量快照）
+void benchStateSnapshot(const Options& options, std::vector<std::string>& results) {
+    auto& checker = ToleranceChecker::getInstance();
+    const std::size_t signals = std::min<std::size_t>(100000, options.maxSignals);
+    const std::size_t refreshes = options.quick ? 5 : 20;
+
+    auto handles = registerMany(checker, "hmi_", signals, 100);
+    std::vector<std::string> ids;
+    ids.reserve(signals);
+    for (std::size_t i = 0; i < signals; ++i) {
+        ids.push_back(signalName("hmi_", i));
+    }
+    std::vector<SignalStatus> statuses(signals);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    volatile int sink = 0;
+    double perSignalUs = nsPerCall(refreshes, [&](std::size_t) {
+        int faults = 0;
+        for (const auto& id : ids) {
+            faults += checker.getSignalState(id) == SignalState::FAULT;
+        }
+        sink = sink + faults;
+    }) / 1e3;
+    double bulkUs = nsPerCall(refreshes, [&](std::size_t) {
+        sink = sink + static_cast<int>(checker.getSignalStates(statuses.data(), statuses.size()));
+    }) / 1e3;
+    double bulkByHandleUs = nsPerCall(refreshes, [&](std::size_t) {
+        sink = sink + static_cast<int>(checker.getSignalStates(handles.data(), handles.size(), statuses.data()));
+    }) / 1e3;
+    removeMany(checker, handles);
+
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+                  "{\"case\":\"state_snapshot\",\"signals\":%zu,\"per_signal_us\":%.1f,"
+                  "\"bulk_us\":%.1f,\"bulk_by_handle_us\":%.1f,\"speedup\":%.1f}",
+                  signals, perSignalUs, bulkUs, bulkByHandleUs, bulkUs > 0.0 ? perSignalUs / bulkUs : 0.0);
+    results.push_back(buffer);
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--max-signals") == 0 && i + 1 < argc) {
+            options.maxSignals = static_cast<std::size_t>(std::strtoull(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--quick") == 0) {
+            options.quick = true;
+        } else {
+            std::fprintf(stderr, "用法: %s [--max-signals N] [--quick]\n", argv[0]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+    std::vector<std::string> results;
+    // 关闭监控器日志，避免干扰JSON输出和计时
+    Logger::instance().setLevel(LogLevel::OFF);
+
+    benchCheckThroughput(options, results);
+    benchRegistryLatency(options, results);
+    benchCApiOverhead(options, results);
+    benchCallbackFanout(options, results);
+    benchStatsOverhead(options, results);
+    benchStateSnapshot(options, results);
+
+    ToleranceChecker::getInstance().stopMonitoring();
+
+    std::printf("{\"benchmark\":\"ToleranceCheckerBench\",\"version\":\"%s\",\"kernel\":\"%s\","
+                "\"hardware_threads\":%u,\"results\":[\n",
+                TC_BENCH_VERSION, SignalHotStore::kernelName(), std::thread::hardware_concurrency());
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        std::printf("  %s%s\n", results[i].c_str(), i + 1 < results.size() ? "," : "");
+    }
+    std::printf("]}\n");
+    return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file classify_bench.cpp
+ * @brief 偏差分类吞吐对比基准
+ *
+ * 对比每秒可分类的信号数量：
+ * - node: 原checkSignal的数据布局，unordered_map节点中混放std::function、time_point与阈值，
+ *         逐个信号经valueCallback取值后计算偏差
+ * - soa-indexed: SignalHotStore按槽位列表聚集分类（监控线程的实际路径）
+ * - soa-contiguous: SignalHotStore对整个存储连续分类
+ */
+
+#include "SignalHotStore.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// 与原SignalInfo相同的节点布局
+struct NodeSignal {
+    std::string signalId;
+    double targetValue;
+    double warningThreshold;
+    double faultThreshold;
+    std::function<void(const std::string&, double)> warningCallback;
+    std::function<void(const std::string&, double)> faultCallback;
+    std::function<double(const std::string&)> valueCallback;
+    int tcMs;
+    int tsMs;
+    int state;
+    std::chrono::steady_clock::time_point registrationTime;
+    std::chrono::steady_clock::time_point lastCheckTime;
+    std::chrono::steady_clock::time_point warningStartTime;
+    std::chrono::steady_clock::time_point faultStartTime;
+};
+
+constexpr int kRounds = 20;
+
+template <typename Fn>
+double measure(std::size_t signalCount, Fn&& pass) {
+    pass();  // 预热
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; ++round) {
+        pass();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(signalCount) * kRounds / seconds;
+}
+
+void runCase(std::size_t signalCount) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> noise(-3.0, 3.0);
+    std::vector<double> source(signalCount);
+    for (auto& value : source) {
+        value = 50.0 + noise(rng);
+    }
+
+    std::unordered_map<std::string, NodeSignal> nodes;
+    nodes.reserve(signalCount);
+    SignalHotStore store;
+    store.reserveSlots(signalCount);
+    std::vector<std::uint32_t> slots(signalCount);
+    for (std::size_t i = 0; i < signalCount; ++i) {
+        NodeSignal node{};
+        node.signalId = "signal_" + std::to_string(i);
+        node.targetValue = 50.0;
+        node.warningThreshold = 1.0;
+        node.faultThreshold = 2.0;
+        node.valueCallback = [&source, i](const std::string&) { return source[i]; };
+        nodes.emplace(node.signalId, std::move(node));
+        store.setThresholds(static_cast<std::uint32_t>(i), 50.0, 1.0, 2.0);
+        store.lastValue(static_cast<std::uint32_t>(i)) = source[i];
+        slots[i] = static_cast<std::uint32_t>(i);
+    }
+    std::vector<std::uint8_t> bands(signalCount);
+
+    volatile std::uint64_t sink = 0;
+    double nodeRate = measure(signalCount, [&] {
+        std::uint64_t faults = 0;
+        for (auto& [signalId, node] : nodes) {
+            double value = node.valueCallback(signalId);
+            double deviation = std::abs(value - node.targetValue);
+            node.state = deviation <= node.warningThreshold ? 1 : deviation <= node.faultThreshold ? 2 : 3;
+            faults += node.state == 3;
+        }
+        sink = sink + faults;
+    });
+
+    double indexedRate = measure(signalCount, [&] {
+        for (std::size_t i = 0; i < signalCount; ++i) {
+            store.lastValue(slots[i]) = source[i];
+        }
+        store.classify(slots.data(), slots.size(), bands.data());
+        sink = sink + bands[signalCount / 2];
+    });
+
+    double contiguousRate = measure(signalCount, [&] {
+        store.classifyAll(bands.data());
+        sink = sink + bands[signalCount / 2];
+    });
+
+    std::printf("%9zu %16.1f %16.1f %16.1f %8.1fx\n", signalCount, nodeRate / 1e6,
+                indexedRate / 1e6, contiguousRate / 1e6, indexedRate / nodeRate);
+}
+
+} // namespace
+
+int main() {
+    std::printf("分类内核: %s\n", SignalHotStore::kernelName());
+    std::printf("%9s %16s %16s %16s %9s\n", "signals", "node(M/s)", "soa-indexed(M/s)",
+                "soa-contig(M/s)", "speedup");
+    for (std::size_t signalCount : {1000u, 10000u, 100000u, 1000000u}) {
+        runCase(signalCount);
+    }
+    return 0;
+}
@@ -0,0 +1,323 @@
+/**
+ * @file kernel_bench.cpp
+ * @brief 批量评估内核与逐信号回调路径的单信号耗时对比基准
+ *
+ * 每轮所有信号各评估一次（分类+去抖），输出每个信号的平均耗时（纳秒）：
+ * - function: 原checkSignal的数据布局，逐个信号经std::function取值后分类并推进状态机
+ * - checker: ToleranceChecker（虚拟时钟+runOnce()，采样周期1ms），每个信号经valueCallback取值
+ * - kernel: ToleranceKernel::evaluate()对连续值数组批量评估
+ *
+ * 结束时比较checker与kernel的最终状态，二者使用相同的值序列与时间，应完全一致。
+ *
+ * 另有一组固定拓扑的信号同时经StaticToleranceSet、checker与kernel运行同一值序列，
+ * 逐步比较三者的状态与警告/故障处理次数，并输出StaticToleranceSet每个信号的平均耗时。
+ * 任一比较不一致时返回非零。
+ */
+
+#include "ToleranceKernel.h"
+#include "ToleranceChecker.h"
+#include "SignalHotStore.h"
+#include "StaticToleranceSet.h"
+#include "Logger.h"
+#include <chrono>
+#include <cmath>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// 与原SignalInfo相同的节点布局
+struct NodeSignal {
+    std::string signalId;
+    double targetValue;
+    double warningThreshold;
+    double faultThreshold;
+    std::function<double(const std::string&)> valueCallback;
+    int tsMs;
+    int state;
+    bool warningTimerActive;
+    bool faultTimerActive;
+    std::chrono::steady_clock::time_point warningStartTime;
+    std::chrono::steady_clock::time_point faultStartTime;
+};
+
+constexpr int kRounds = 50;
+constexpr int kTsMs = 3;
+
+// 第round轮第i个信号的值：大部分在容差内，少数信号周期性越过警告/故障阈值
+void fillValues(std::vector<double>& values, const std::vector<double>& noise, int round) {
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const std::size_t phase = (i + static_cast<std::size_t>(round)) % 64;
+        const double excursion = phase < 4 ? 5.0 : (phase < 10 ? 1.5 : 0.0);
+        values[i] = 50.0 + noise[i] + excursion;
+    }
+}
+
+template <typename Fn>
+double measureNs(std::size_t signalCount, std::vector<double>& values, const std::vector<double>& noise, Fn&& pass) {
+    double seconds = 0.0;
+    for (int round = 0; round < kRounds; ++round) {
+        fillValues(values, noise, round);
+        auto start = std::chrono::steady_clock::now();
+        pass(round);
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return seconds * 1e9 / (static_cast<double>(signalCount) * kRounds);
+}
+
+// 固定拓扑的信号描述，阈值、tc与ts各不相同
+struct SpindleTemp {
+    static constexpr double targetValue = 60.0;
+    static constexpr double warningThreshold = 5.0;
+    static constexpr double faultThreshold = 10.0;
+    static constexpr int tcMs = 20;
+    static constexpr int tsMs = 5;
+};
+struct CoolantPressure {
+    static constexpr double targetValue = 3.5;
+    static constexpr double warningThreshold = 0.2;
+    static constexpr double faultThreshold = 0.5;
+    static constexpr int tcMs = 0;
+    static constexpr int tsMs = 0;
+};
+struct AxisLoad {
+    static constexpr double targetValue = 40.0;
+    static constexpr double warningThreshold = 8.0;
+    static constexpr double faultThreshold = 8.0;
+    static constexpr int tcMs = 7;
+    static constexpr int tsMs = 12;
+};
+struct SupplyVoltage {
+    static constexpr double targetValue = 24.0;
+    static constexpr double warningThreshold = 0.5;
+    static constexpr double faultThreshold = 1.5;
+    static constexpr int tcMs = 3;
+    static constexpr int tsMs = 2;
+};
+
+using Machine = StaticToleranceSet<SpindleTemp, CoolantPressure, AxisLoad, SupplyVoltage>;
+
+template <typename Signal>
+KernelSignalConfig kernelConfigOf() {
+    KernelSignalConfig config;
+    config.targetValue = Signal::targetValue;
+    config.warningThreshold = Signal::warningThreshold;
+    config.faultThreshold = Signal::faultThreshold;
+    config.tc = Signal::tcMs;
+    config.ts = Signal::tsMs;
+    return config;
+}
+
+template <typename Signal>
+SignalConfig checkerConfigOf(const std::array<double, Machine::kSize>& values, std::uint64_t& handled) {
+    SignalConfig config{};
+    config.targetValue = Signal::targetValue;
+    config.warningThreshold = Signal::warningThreshold;
+    config.faultThreshold = Signal::faultThreshold;
+    config.tcMs = Signal::tcMs;
+    config.tsMs = Signal::tsMs;
+    config.valueCallback = [&values](const std::string&) { return values[Machine::indexOf<Signal>()]; };
+    config.warningCallback = [&handled](const std::string&, double) { ++handled; };
+    config.faultCallback = [&handled](const std::string&, double) { ++handled; };
+    return config;
+}
+
+// 第step步的值：目标值附近的噪声，按信号错开的周期越过警告/故障阈值
+void fillMachineValues(std::array<double, Machine::kSize>& values, std::mt19937_64& rng, int step) {
+    static const std::array<double, Machine::kSize> targets{SpindleTemp::targetValue, CoolantPressure::targetValue,
+                                                           AxisLoad::targetValue, SupplyVoltage::targetValue};
+    static const std::array<double, Machine::kSize> faults{SpindleTemp::faultThreshold, CoolantPressure::faultThreshold,
+                                                          AxisLoad::faultThreshold, SupplyVoltage::faultThreshold};
+    std::uniform_real_distribution<double> distribution(-0.3, 0.3);
+    for (std::size_t i = 0; i < Machine::kSize; ++i) {
+        const int phase = (step / static_cast<int>(3 + i * 2) + static_cast<int>(i)) % 8;
+        const double excursion = phase < 2 ? 1.5 : (phase < 4 ? 0.8 : 0.0);
+        values[i] = targets[i] + faults[i] * (excursion + distribution(rng));
+    }
+}
+
+// StaticToleranceSet与checker、kernel逐步比较，返回不一致的次数
+std::size_t runStaticCase(int steps) {
+    const auto start = std::chrono::steady_clock::time_point(std::chrono::hours(1));
+    std::array<double, Machine::kSize> values{};
+
+    Machine machine(start);
+    std::uint64_t staticHandled = 0;
+    auto handler = [&staticHandled](auto, SignalState, double) { ++staticHandled; };
+
+    auto clock = std::make_shared<VirtualClock>(start);
+    ToleranceChecker checker(1, clock);
+    std::uint64_t checkerHandled = 0;
+    std::vector<SignalHandle> handles = checker.registerSignals({
+        {"spindle_temp", checkerConfigOf<SpindleTemp>(values, checkerHandled)},
+        {"coolant_pressure", checkerConfigOf<CoolantPressure>(values, checkerHandled)},
+        {"axis_load", checkerConfigOf<AxisLoad>(values, checkerHandled)},
+        {"supply_voltage", checkerConfigOf<SupplyVoltage>(values, checkerHandled)},
+    });
+    checker.nextDueTime();  // 应用注册变更
+
+    const std::array<KernelSignalConfig, Machine::kSize> kernelConfigs{
+        kernelConfigOf<SpindleTemp>(), kernelConfigOf<CoolantPressure>(), kernelConfigOf<AxisLoad>(),
+        kernelConfigOf<SupplyVoltage>()};
+    ToleranceKernel kernel(kernelConfigs.data(), kernelConfigs.size(), 0);
+
+    std::mt19937_64 rng(7);
+    std::vector<std::array<double, Machine::kSize>> trace(static_cast<std::size_t>(steps));
+    for (int step = 1; step <= steps; ++step) {
+        fillMachineValues(trace[step - 1], rng, step);
+    }
+
+    // 计时：独立的信号集完整运行一遍值序列
+    Machine timed(start);
+    volatile std::uint64_t sink = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int step = 1; step <= steps; ++step) {
+        timed.evaluateAll(trace[step - 1], start + std::chrono::milliseconds(step));
+    }
+    const double staticSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    sink = sink + static_cast<std::uint64_t>(timed.state(0));
+
+    std::array<SignalStatus, Machine::kSize> statuses{};
+    std::size_t mismatches = 0;
+    for (int step = 1; step <= steps; ++step) {
+        values = trace[step - 1];
+        const auto now = start + std::chrono::milliseconds(step);
+        machine.evaluateAll(values, now, handler);
+        clock->set(now);
+        checker.runOnce();
+        kernel.evaluate(values.data(), values.size(), step, nullptr);
+
+        checker.getSignalStates(handles.data(), handles.size(), statuses.data());
+        for (std::size_t i = 0; i < Machine::kSize; ++i) {
+            mismatches += machine.state(i) != statuses[i].state || machine.state(i) != kernel.state(i);
+        }
+    }
+    mismatches += staticHandled != checkerHandled;
+
+    std::printf("static: %zu个信号 x %d步，%.2f ns/信号，处理器调用 %llu（checker回调 %llu），不一致 %zu\n",
+                Machine::kSize, steps, staticSeconds * 1e9 / (static_cast<double>(Machine::kSize) * steps),
+                static_cast<unsigned long long>(staticHandled), static_cast<unsigned long long>(checkerHandled),
+                mismatches);
+    return mismatches;
+}
+
+void runCase(std::size_t signalCount) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> distribution(-0.5, 0.5);
+    std::vector<double> noise(signalCount);
+    for (auto& value : noise) {
+        value = distribution(rng);
+    }
+    std::vector<double> values(signalCount);
+
+    // function：逐信号std::function取值，节点内分类与去抖
+    std::unordered_map<std::string, NodeSignal> nodes;
+    nodes.reserve(signalCount);
+    for (std::size_t i = 0; i < signalCount; ++i) {
+        NodeSignal node{};
+        node.signalId = "signal_" + std::to_string(i);
+        node.targetValue = 50.0;
+        node.warningThreshold = 1.0;
+        node.faultThreshold = 2.0;
+        node.tsMs = kTsMs;
+        node.valueCallback = [&values, i](const std::string&) { return values[i]; };
+        nodes.emplace(node.signalId, std::move(node));
+    }
+    const auto origin = std::chrono::steady_clock::now();
+    volatile std::uint64_t sink = 0;
+    double functionNs = measureNs(signalCount, values, noise, [&](int round) {
+        const auto now = origin + std::chrono::milliseconds(round + 1);
+        std::uint64_t faults = 0;
+        for (auto& [signalId, node] : nodes) {
+            const double deviation = std::abs(node.valueCallback(signalId) - node.targetValue);
+            if (deviation <= node.warningThreshold) {
+                node.state = 1;
+                node.warningTimerActive = node.faultTimerActive = false;
+            } else if (deviation <= node.faultThreshold) {
+                node.faultTimerActive = false;
+                if (!node.warningTimerActive) {
+                    node.warningTimerActive = true;
+                    node.warningStartTime = now;
+                }
+                if (now - node.warningStartTime >= std::chrono::milliseconds(node.tsMs)) {
+                    node.state = 2;
+                }
+            } else {
+                if (!node.faultTimerActive) {
+                    node.faultTimerActive = true;
+                    node.faultStartTime = now;
+                }
+                if (now - node.faultStartTime >= std::chrono::milliseconds(node.tsMs)) {
+                    node.state = 3;
+                }
+            }
+            faults += node.state == 3;
+        }
+        sink = sink + faults;
+    });
+
+    // checker：真实的监控器路径，虚拟时钟每轮推进1ms，全部信号在同一轮到期
+    auto clock = std::make_shared<VirtualClock>(std::chrono::steady_clock::time_point(std::chrono::hours(1)));
+    ToleranceChecker checker(1, clock);
+    std::vector<SignalRegistration> registrations(signalCount);
+    for (std::size_t i = 0; i < signalCount; ++i) {
+        SignalConfig config{};
+        config.targetValue = 50.0;
+        config.warningThreshold = 1.0;
+        config.faultThreshold = 2.0;
+        config.tcMs = 0;
+        config.tsMs = kTsMs;
+        config.valueCallback = [&values, i](const std::string&) { return values[i]; };
+        registrations[i] = {"signal_" + std::to_string(i), std::move(config)};
+    }
+    std::vector<SignalHandle> handles = checker.registerSignals(registrations);
+    checker.nextDueTime();  // 应用注册变更
+    double checkerNs = measureNs(signalCount, values, noise, [&](int) {
+        clock->advance(std::chrono::milliseconds(1));
+        checker.runOnce();
+    });
+
+    // kernel：连续数组批量评估，时间单位为毫秒
+    KernelSignalConfig kernelConfig;
+    kernelConfig.targetValue = 50.0;
+    kernelConfig.warningThreshold = 1.0;
+    kernelConfig.faultThreshold = 2.0;
+    kernelConfig.tc = 0;
+    kernelConfig.ts = kTsMs;
+    std::vector<KernelSignalConfig> kernelConfigs(signalCount, kernelConfig);
+    ToleranceKernel kernel(kernelConfigs.data(), signalCount, 0);
+    std::vector<SignalState> states(signalCount);
+    double kernelNs = measureNs(signalCount, values, noise, [&](int round) {
+        sink = sink + kernel.evaluate(values.data(), signalCount, round + 1, states.data());
+    });
+
+    std::vector<SignalStatus> statuses(signalCount);
+    checker.getSignalStates(handles.data(), handles.size(), statuses.data());
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < signalCount; ++i) {
+        mismatches += statuses[i].state != states[i];
+    }
+
+    std::printf("%9zu %14.2f %14.2f %14.2f %10.1fx %10.1fx %11zu\n", signalCount, functionNs, checkerNs, kernelNs,
+                functionNs / kernelNs, checkerNs / kernelNs, mismatches);
+}
+
+} // namespace
+
+int main() {
+    Logger::instance().setLevel(LogLevel::WARN);
+    std::printf("分类内核: %s\n", SignalHotStore::kernelName());
+    std::printf("%9s %14s %14s %14s %11s %11s %11s\n", "signals", "function(ns)", "checker(ns)", "kernel(ns)",
+                "vs-function", "vs-checker", "mismatches");
+    for (std::size_t signalCount : {1000u, 10000u, 100000u, 1000000u}) {
+        runCase(signalCount);
+    }
+    return runStaticCase(20000) == 0 ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file registry_contention.cpp
+ * @brief 注册表并发模式对比基准
+ *
+ * 监控线程对大量回调较慢的信号进行检查的同时，多个查询线程持续调用getSignalState，
+ * 分别在LOCKED与SNAPSHOT模式下统计查询延迟分布。
+ */
+
+#include "ToleranceChecker.h"
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kSignalCount = 2000;
+constexpr int kReaderCount = 2;
+constexpr auto kRunTime = std::chrono::seconds(2);
+
+// 模拟耗时约2微秒的数据源
+double slowValue(const std::string&) {
+    auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(2);
+    while (std::chrono::steady_clock::now() < until) {
+    }
+    return 0.0;
+}
+
+std::string signalName(int index) {
+    return "bench_signal_" + std::to_string(index);
+}
+
+void runCase(ToleranceChecker& checker, RegistryMode mode, const char* name) {
+    checker.setRegistryMode(mode);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    std::vector<std::vector<double>> latencies(kReaderCount);
+    std::vector<std::thread> readers;
+    auto deadline = std::chrono::steady_clock::now() + kRunTime;
+    for (int r = 0; r < kReaderCount; ++r) {
+        readers.emplace_back([&, r] {
+            auto& samples = latencies[r];
+            std::string id;
+            for (int i = r; std::chrono::steady_clock::now() < deadline; i += 7) {
+                id = signalName(i % kSignalCount);
+                auto start = std::chrono::steady_clock::now();
+                checker.getSignalState(id);
+                auto end = std::chrono::steady_clock::now();
+                samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    std::vector<double> all;
+    for (auto& samples : latencies) {
+        all.insert(all.end(), samples.begin(), samples.end());
+    }
+    std::sort(all.begin(), all.end());
+    auto percentile = [&](double p) { return all[static_cast<size_t>(p * (all.size() - 1))]; };
+
+    std::printf("%-9s 查询次数 %9zu  p50 %8.2fus  p99 %10.2fus  max %10.2fus\n",
+                name, all.size(), percentile(0.50), percentile(0.99), all.back());
+}
+
+} // namespace
+
+int main() {
+    auto& checker = ToleranceChecker::getInstance();
+
+    Logger::instance().setLevel(LogLevel::OFF);  // 屏蔽注册与状态日志，结果经printf输出
+    for (int i = 0; i < kSignalCount; ++i) {
+        SignalConfig config;
+        config.targetValue = 0.0;
+        config.warningThreshold = 1.0;
+        config.faultThreshold = 2.0;
+        config.valueCallback = slowValue;
+        config.tcMs = 0;
+        config.tsMs = 0;
+        config.samplePeriodMs = 10;
+        checker.registerSignal(signalName(i), config);
+    }
+
+    std::printf("信号数 %d（每次取值约2us，采样周期10ms），查询线程 %d，每种模式运行 %llds\n",
+                kSignalCount, kReaderCount, static_cast<long long>(kRunTime.count()));
+    runCase(checker, RegistryMode::LOCKED, "LOCKED");
+    runCase(checker, RegistryMode::SNAPSHOT, "SNAPSHOT");
+
+    checker.stopMonitoring();
+    return 0;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file replay_bench.cpp
+ * @brief 事件日志回放的一致性与速度基准
+ *
+ * 1) 录制：使用虚拟时钟的监控器逐轮运行，信号经valueCallback取值，事件日志记录每个参与分类的原始样本；
+ * 2) 回放：另一个监控器注册同样的信号（同样带valueCallback），经ReplayEngine回放日志。
+ *
+ * 比较两次运行的状态迁移事件（信号、前后状态、样本值与样本时间）与警告/故障回调次数，应完全一致；
+ * 回放期间valueCallback不应被调用。输出录制与回放的耗时及回放速度（样本/秒）。
+ *
+ * 用法: ToleranceCheckerReplayBench [--signals N] [--seconds N]
+ */
+
+#include "ReplayEngine.h"
+#include "JournalReader.h"
+#include "Logger.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::size_t signals{500};  ///< 信号数量
+    int seconds{30};           ///< 录制的虚拟时长（秒）
+};
+
+struct Counters {
+    std::atomic<std::uint64_t> warnings{0};    ///< 警告回调次数
+    std::atomic<std::uint64_t> faults{0};      ///< 故障回调次数
+    std::atomic<std::uint64_t> valueReads{0};  ///< valueCallback调用次数
+};
+
+const auto kStart = std::chrono::steady_clock::time_point(std::chrono::hours(1));
+
+// 信号i在时间now的值：确定性的噪声，少数时段越过警告/故障阈值
+double signalValue(std::size_t i, std::chrono::steady_clock::time_point now) {
+    const auto ms = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - kStart).count());
+    std::uint64_t hash = (i + 1) * 0x9E3779B97F4A7C15ull ^ ms * 0xBF58476D1CE4E5B9ull;
+    hash ^= hash >> 31;
+    const double noise = static_cast<double>(hash % 1000) / 1000.0 - 0.5;
+    const std::uint64_t phase = (ms / 250 + i) % 40;
+    const double excursion = phase == 0 ? 6.0 : (phase < 3 ? 3.0 : 0.0);
+    return 50.0 + noise + excursion;
+}
+
+void registerSignals(ToleranceChecker& checker, std::size_t count, Counters& counters,
+                     const std::shared_ptr<VirtualClock>& clock) {
+    std::vector<SignalRegistration> registrations(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        SignalConfig config{};
+        config.targetValue = 50.0;
+        config.warningThreshold = 2.0;
+        config.faultThreshold = 5.0;
+        config.tcMs = 100;
+        config.tsMs = 20;
+        config.samplePeriodMs = 5 << (i % 3);
+        config.valueCallback = [&counters, clock, i](const std::string&) {
+            counters.valueReads.fetch_add(1, std::memory_order_relaxed);
+            return signalValue(i, clock->now());
+        };
+        config.warningCallback = [&counters](const std::string&, double) { ++counters.warnings; };
+        config.faultCallback = [&counters](const std::string&, double) { ++counters.faults; };
+        registrations[i] = {"signal_" + std::to_string(i), std::move(config)};
+    }
+    checker.registerSignals(registrations);
+}
+
+std::vector<TransitionEvent> drainTransitions(ToleranceChecker& checker, std::uint64_t& cursor) {
+    std::vector<TransitionEvent> events;
+    std::vector<TransitionEvent> buffer(4096);
+    std::size_t count = 0;
+    do {
+        if (checker.readTransitions(cursor, buffer.data(), buffer.size(), count) != TransitionReadStatus::OK) {
+            std::fprintf(stderr, "状态迁移事件流溢出\n");
+            std::exit(2);
+        }
+        events.insert(events.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(count));
+    } while (count == buffer.size());
+    return events;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--signals") == 0) {
+            options.signals = std::strtoul(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--seconds") == 0) {
+            options.seconds = std::atoi(argv[i + 1]);
+        }
+    }
+    Logger::instance().setLevel(LogLevel::WARN);
+
+    char directory[] = "/tmp/tc_replay_XXXXXX";
+    if (!mkdtemp(directory)) {
+        std::perror("mkdtemp");
+        return 1;
+    }
+
+    // 1) 录制
+    Counters live;
+    auto liveClock = std::make_shared<VirtualClock>(kStart);
+    ToleranceChecker recorder(1, liveClock);
+    registerSignals(recorder, options.signals, live, liveClock);
+    JournalConfig journal;
+    journal.directory = directory;
+    journal.recordSamples = true;
+    recorder.enableJournal(journal);
+    recorder.enableTransitionStream(1u << 22);
+    recorder.nextDueTime();
+    std::uint64_t liveCursor = recorder.subscribeTransitions();
+
+    const auto end = kStart + std::chrono::seconds(options.seconds);
+    auto wallStart = std::chrono::steady_clock::now();
+    for (auto due = recorder.nextDueTime(); due <= end; due = recorder.nextDueTime()) {
+        liveClock->set(due);
+        recorder.runOnce();
+    }
+    const double recordSeconds = secondsSince(wallStart);
+    const std::uint64_t samples = recorder.getJournalStats().records;
+    recorder.disableJournal();
+    recorder.nextDueTime();  // 关闭段文件
+    const auto liveEvents = drainTransitions(recorder, liveCursor);
+
+    // 2) 回放：虚拟时钟从录制的起始时间开始，tc等待期与录制时一致
+    Counters replayed;
+    auto replayClock = std::make_shared<VirtualClock>(kStart);
+    ToleranceChecker player(1, replayClock);
+    registerSignals(player, options.signals, replayed, replayClock);
+    player.enableTransitionStream(1u << 22);
+    player.nextDueTime();
+    std::uint64_t replayCursor = player.subscribeTransitions();
+
+    wallStart = std::chrono::steady_clock::now();
+    auto engine = ReplayEngine::create(player);
+    engine->feedJournal(directory);
+    engine->flush();
+    const double replaySeconds = secondsSince(wallStart);
+    const ReplayStats stats = engine->stats();
+    engine.reset();
+    const auto replayEvents = drainTransitions(player, replayCursor);
+
+    std::size_t mismatches = liveEvents.size() > replayEvents.size() ? liveEvents.size() - replayEvents.size()
+                                                                     : replayEvents.size() - liveEvents.size();
+    for (std::size_t i = 0; i < liveEvents.size() && i < replayEvents.size(); ++i) {
+        const TransitionEvent& a = liveEvents[i];
+        const TransitionEvent& b = replayEvents[i];
+        mismatches += a.handle.index != b.handle.index || a.oldState != b.oldState || a.newState != b.newState ||
+                      a.value != b.value || a.sampleTime != b.sampleTime;
+    }
+
+    for (const auto& segment : JournalReader::listSegments(directory)) {
+        unlink(segment.path.c_str());
+    }
+    rmdir(directory);
+
+    std::printf("信号: %zu，虚拟时长: %d秒，日志记录: %llu\n", options.signals, options.seconds,
+                static_cast<unsigned long long>(samples));
+    std::printf("%-8s %10s %12s %10s %10s %12s\n", "run", "wall(s)", "transitions", "warnings", "faults",
+                "valueReads");
+    std::printf("%-8s %10.3f %12zu %10llu %10llu %12llu\n", "live", recordSeconds, liveEvents.size(),
+                static_cast<unsigned long long>(live.warnings.load()),
+                static_cast<unsigned long long>(live.faults.load()),
+                static_cast<unsigned long long>(live.valueReads.load()));
+    std::printf("%-8s %10.3f %12zu %10llu %10llu %12llu\n", "replay", replaySeconds, replayEvents.size(),
+                static_cast<unsigned long long>(replayed.warnings.load()),
+                static_cast<unsigned long long>(replayed.faults.load()),
+                static_cast<unsigned long long>(replayed.valueReads.load()));
+    std::printf("回放样本: %llu（late %llu，unknown %llu），%.0f 样本/秒，迁移不一致: %zu\n",
+                static_cast<unsigned long long>(stats.samples), static_cast<unsigned long long>(stats.late),
+                static_cast<unsigned long long>(stats.unknown), stats.samples / replaySeconds, mismatches);
+
+    const bool identical = mismatches == 0 && replayed.valueReads.load() == 0 &&
+                           live.warnings.load() == replayed.warnings.load() &&
+                           live.faults.load() == replayed.faults.load();
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,248 @@
+/**
+ * @file BatchCoalescer.h
+ * @brief 事件批量合并交付器头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了把单个事件合并为批次、由专用线程整批交付的合并器。
+ * 生产者（监控线程）只把事件追加到当前批次，批次攒满或合并窗口到期后整批移交，
+ * 消费者每批只需一次数据库插入或一次网络写入，慢消费者不阻塞检查循环。
+ */
+
+#pragma once
+
+#include "CallbackDispatcher.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 批量交付配置
+ */
+struct BatchConfig {
+    std::size_t maxBatch{1024};                  ///< 单批最多事件数，攒满即交付
+    int maxLatencyMs{0};                         ///< 合并窗口（毫秒）：批次中最早的事件最多等待多久交付，0表示每轮检查结束即交付
+    std::size_t queueCapacity{64};               ///< 待交付批次的队列容量
+    OverflowPolicy policy{OverflowPolicy::DROP}; ///< 队列满时的处理策略
+};
+
+/**
+ * @brief 批量交付统计
+ */
+struct BatchStats {
+    bool enabled{false};            ///< 批量交付是否启用
+    std::uint64_t batches{0};       ///< 已交付的批次数
+    std::uint64_t events{0};        ///< 已交付的事件数
+    std::uint64_t largestBatch{0};  ///< 最大批次的事件数
+    std::uint64_t dropped{0};       ///< 因队列满被丢弃的事件数
+    std::uint64_t blocked{0};       ///< 因队列满而等待的移交次数
+    std::uint64_t exceptions{0};    ///< 回调抛出异常的次数
+};
+
+/**
+ * @brief 事件批量合并交付器
+ *
+ * append()、poll()、seal()与deadline()只能由一个生产者线程调用；stats()可被任意线程调用。
+ * 批次缓冲区在交付后回收复用，稳定运行时不再分配内存。
+ * 回调在专用交付线程上按移交顺序逐批调用，数组只在回调期间有效。
+ * 析构时移交未满的批次，并在交付线程退出前交付全部已移交的批次。
+ *
+ * @tparam T 事件类型
+ */
+template <typename T>
+class BatchCoalescer {
+public:
+    using Callback = std::function<void(const T* events, std::size_t count)>;  ///< 批量回调类型
+    using time_point = std::chrono::steady_clock::time_point;                  ///< 时间点类型
+
+    /**
+     * @brief 构造合并器并启动交付线程
+     * @param callback 批量回调
+     * @param config 交付配置，非法值按最小有效值处理
+     */
+    BatchCoalescer(Callback callback, const BatchConfig& config)
+        : m_callback(std::move(callback)), m_config(config) {
+        m_config.maxBatch = std::max<std::size_t>(m_config.maxBatch, 1);
+        m_config.maxLatencyMs = std::max(m_config.maxLatencyMs, 0);
+        m_config.queueCapacity = std::max<std::size_t>(m_config.queueCapacity, 1);
+        m_open.reserve(m_config.maxBatch);
+        m_thread = std::thread(&BatchCoalescer::deliveryLoop, this);
+    }
+
+    /**
+     * @brief 析构函数
+     * 交付全部剩余事件后停止交付线程
+     */
+    ~BatchCoalescer() {
+        seal();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_ready.notify_one();
+        m_thread.join();
+    }
+
+    BatchCoalescer(const BatchCoalescer&) = delete;            ///< 禁用拷贝构造
+    BatchCoalescer& operator=(const BatchCoalescer&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 获取生效的交付配置
+     */
+    const BatchConfig& config() const { return m_config; }
+
+    /**
+     * @brief 追加事件到当前批次，攒满maxBatch个时立即移交
+     * @param event 事件
+     * @param now 当前时间，批次的第一个事件以此开始计算合并窗口
+     */
+    void append(const T& event, time_point now) {
+        if (m_open.empty()) {
+            m_openSince = now;
+        }
+        m_open.push_back(event);
+        if (m_open.size() >= m_config.maxBatch) {
+            seal();
+        }
+    }
+
+    /**
+     * @brief 检查合并窗口，到期（或未设置窗口）时移交当前批次
+     * @param now 当前时间
+     */
+    void poll(time_point now) {
+        if (!m_open.empty() && now - m_openSince >= std::chrono::milliseconds(m_config.maxLatencyMs)) {
+            seal();
+        }
+    }
+
+    /**
+     * @brief 当前批次必须移交的时间，当前批次为空时返回time_point::max()
+     */
+    time_point deadline() const {
+        return m_open.empty() ? time_point::max() : m_openSince + std::chrono::milliseconds(m_config.maxLatencyMs);
+    }
+
+    /**
+     * @brief 立即移交当前批次（为空时不做任何事）
+     *
+     * 队列满时按溢出策略丢弃该批次或等待交付线程腾出空位
+     */
+    void seal() {
+        if (m_open.empty()) {
+            return;
+        }
+        std::vector<T> batch;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_queue.size() >= m_config.queueCapacity) {
+                if (m_config.policy == OverflowPolicy::DROP) {
+                    m_dropped.fetch_add(m_open.size(), std::memory_order_relaxed);
+                    m_open.clear();
+                    return;
+                }
+                m_blocked.fetch_add(1, std::memory_order_relaxed);
+                m_space.wait(lock, [this] { return m_queue.size() < m_config.queueCapacity; });
+            }
+            m_queue.push_back(std::move(m_open));
+            if (!m_spare.empty()) {
+                batch = std::move(m_spare.back());
+                m_spare.pop_back();
+            }
+        }
+        m_ready.notify_one();
+        m_open = std::move(batch);
+        m_open.reserve(m_config.maxBatch);
+    }
+
+    /**
+     * @brief 当前线程是否为交付线程（即是否在回调内）
+     */
+    bool onDeliveryThread() const { return std::this_thread::get_id() == m_thread.get_id(); }
+
+    /**
+     * @brief 获取交付统计
+     */
+    BatchStats stats() const {
+        BatchStats stats;
+        stats.enabled = true;
+        stats.batches = m_batches.load(std::memory_order_relaxed);
+        stats.events = m_events.load(std::memory_order_relaxed);
+        stats.largestBatch = m_largestBatch.load(std::memory_order_relaxed);
+        stats.dropped = m_dropped.load(std::memory_order_relaxed);
+        stats.blocked = m_blocked.load(std::memory_order_relaxed);
+        stats.exceptions = m_exceptions.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    void deliveryLoop() {
+        std::vector<T> batch;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_ready.wait(lock, [this] { return !m_queue.empty() || m_stopping; });
+            if (m_queue.empty()) {
+                return;  // 已停止且全部交付
+            }
+            batch = std::move(m_queue.front());
+            m_queue.pop_front();
+            lock.unlock();
+            m_space.notify_one();
+
+            deliver(batch);
+
+            batch.clear();
+            lock.lock();
+            m_spare.push_back(std::move(batch));
+        }
+    }
+
+    void deliver(const std::vector<T>& batch) {
+        try {
+            m_callback(batch.data(), batch.size());
+        } catch (const std::exception& e) {
+            m_exceptions.fetch_add(1, std::memory_order_relaxed);
+            TC_LOG_ERROR("批量回调发生错误: %s", e.what());
+        }
+        // 只有交付线程写入，无需读改写
+        m_batches.store(m_batches.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        m_events.store(m_events.load(std::memory_order_relaxed) + batch.size(), std::memory_order_relaxed);
+        if (batch.size() > m_largestBatch.load(std::memory_order_relaxed)) {
+            m_largestBatch.store(batch.size(), std::memory_order_relaxed);
+        }
+    }
+
+private:
+    Callback m_callback;                       ///< 批量回调
+    BatchConfig m_config;                      ///< 生效的交付配置
+    std::vector<T> m_open;                     ///< 正在合并的批次（仅生产者访问）
+    time_point m_openSince;                    ///< 当前批次第一个事件的时间（仅生产者访问）
+
+    std::mutex m_mutex;                        ///< 保护移交队列与空闲缓冲区
+    std::condition_variable m_ready;           ///< 通知交付线程有新批次
+    std::condition_variable m_space;           ///< 通知生产者队列出现空位
+    std::deque<std::vector<T>> m_queue;        ///< 已移交、待交付的批次
+    std::vector<std::vector<T>> m_spare;       ///< 交付后回收的批次缓冲区
+    bool m_stopping{false};                    ///< 停止标志（受m_mutex保护）
+
+    std::atomic<std::uint64_t> m_batches{0};      ///< 已交付批次数
+    std::atomic<std::uint64_t> m_events{0};       ///< 已交付事件数
+    std::atomic<std::uint64_t> m_largestBatch{0}; ///< 最大批次的事件数
+    std::atomic<std::uint64_t> m_dropped{0};      ///< 丢弃的事件数
+    std::atomic<std::uint64_t> m_blocked{0};      ///< 等待次数
+    std::atomic<std::uint64_t> m_exceptions{0};   ///< 回调异常次数
+    std::thread m_thread;                      ///< 交付线程（最后构造，保证其余成员已就绪）
+};
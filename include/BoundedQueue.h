@@ -0,0 +1,133 @@
+/**
+ * @file BoundedQueue.h
+ * @brief 有界无锁队列头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了基于序号槽位的有界多生产者/多消费者无锁队列
+ * （Vyukov bounded MPMC queue），用于监控线程与回调派发线程之间传递事件。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief 有界无锁队列
+ *
+ * 容量向上取整为2的幂。每个槽位带有序号，生产者与消费者各自通过
+ * CAS推进位置，互不加锁；队列满时tryPush返回false，空时tryPop返回false。
+ *
+ * @tparam T 元素类型，需可默认构造和移动赋值
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    /**
+     * @brief 构造队列
+     * @param capacity 期望容量，实际容量为不小于它的2的幂（至少为2）
+     */
+    explicit BoundedQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;            ///< 禁用拷贝构造
+    BoundedQueue& operator=(const BoundedQueue&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 尝试入队
+     * @param value 待入队的元素，成功时被移走
+     * @return 成功返回true，队列满时返回false
+     */
+    bool tryPush(T& value) {
+        std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 尝试出队
+     * @param value 输出参数，存储出队的元素
+     * @return 成功返回true，队列空时返回false
+     */
+    bool tryPop(T& value) {
+        std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->data);
+        cell->data = T{};
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 获取队列容量
+     */
+    std::size_t capacity() const { return m_mask + 1; }
+
+    /**
+     * @brief 获取当前元素数量的近似值
+     */
+    std::size_t sizeApprox() const {
+        const std::size_t tail = m_enqueuePos.load(std::memory_order_relaxed);
+        const std::size_t head = m_dequeuePos.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+private:
+    /**
+     * @brief 队列槽位
+     */
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};  ///< 槽位序号
+        T data{};                              ///< 元素
+    };
+
+    static constexpr std::size_t kCacheLine = 64;  ///< 缓存行大小
+
+    std::unique_ptr<Cell[]> m_cells;                             ///< 槽位数组
+    std::size_t m_mask{0};                                       ///< 下标掩码
+    alignas(kCacheLine) std::atomic<std::size_t> m_enqueuePos{0}; ///< 入队位置
+    alignas(kCacheLine) std::atomic<std::size_t> m_dequeuePos{0}; ///< 出队位置
+};
@@ -0,0 +1,164 @@
+/**
+ * @file BroadcastRing.h
+ * @brief 单写者广播环形缓冲区头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了一个写者、任意多个读者的广播环形缓冲区。
+ * 写者从不等待读者，旧元素被新元素覆盖；每个读者持有自己的读取位置，
+ * 按自身节奏批量读取，落后超过容量时可以明确检测到溢出。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+/**
+ * @brief 单写者广播环形缓冲区
+ *
+ * 容量向上取整为2的幂。每个元素有一个全局连续的序号，第一个元素的序号由构造参数给定。
+ * 槽位以顺序锁保护：写入时印记先置为奇数，写完后置为2倍序号；
+ * 读者在读取前后比对印记，被覆盖或正在被覆盖的槽位即视为溢出。
+ *
+ * publish()只能由一个线程调用；read()与lastPublished()可被任意线程并发调用，不加锁。
+ *
+ * @tparam T 元素类型，必须可平凡复制
+ */
+template <typename T>
+class BroadcastRing {
+    static_assert(std::is_trivially_copyable<T>::value, "BroadcastRing元素必须可平凡复制");
+
+public:
+    /**
+     * @brief 读取结果
+     */
+    enum class ReadStatus {
+        OK,      ///< 读取成功（可能为0个元素）
+        OVERRUN  ///< 读取位置已被覆盖或不属于本缓冲区，之前已读出的元素仍然有效
+    };
+
+    /**
+     * @brief 构造缓冲区
+     * @param capacity 容量，向上取整为2的幂
+     * @param firstSequence 第一个元素的序号（须大于0）
+     */
+    explicit BroadcastRing(std::size_t capacity, std::uint64_t firstSequence = 1)
+        : m_capacity(roundUpPow2(capacity)),
+          m_mask(m_capacity - 1),
+          m_firstSequence(firstSequence),
+          m_slots(new Slot[m_capacity]),
+          m_lastPublished(firstSequence - 1) {}
+
+    BroadcastRing(const BroadcastRing&) = delete;            ///< 禁用拷贝构造
+    BroadcastRing& operator=(const BroadcastRing&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 获取容量
+     */
+    std::size_t capacity() const { return m_capacity; }
+
+    /**
+     * @brief 获取第一个元素的序号
+     */
+    std::uint64_t firstSequence() const { return m_firstSequence; }
+
+    /**
+     * @brief 获取下一个发布的元素将得到的序号（仅写者调用）
+     */
+    std::uint64_t nextSequence() const { return m_lastPublished.load(std::memory_order_relaxed) + 1; }
+
+    /**
+     * @brief 获取最近发布的元素序号，尚未发布时为firstSequence()-1
+     */
+    std::uint64_t lastPublished() const { return m_lastPublished.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 发布一个元素（仅写者调用），可能覆盖最旧的元素
+     * @return 元素的序号
+     */
+    std::uint64_t publish(const T& value) {
+        const std::uint64_t sequence = nextSequence();
+        Slot& slot = m_slots[sequence & m_mask];
+
+        std::uint64_t words[kWords] = {};
+        std::memcpy(words, &value, sizeof(T));
+
+        slot.stamp.store(2 * sequence - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < kWords; ++i) {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+        slot.stamp.store(2 * sequence, std::memory_order_release);
+        m_lastPublished.store(sequence, std::memory_order_release);
+        return sequence;
+    }
+
+    /**
+     * @brief 从读取位置开始批量读取
+     * @param cursor 输入输出参数，下一个要读取的序号，返回时指向未读的第一个元素
+     * @param out 输出数组
+     * @param capacity 输出数组容量
+     * @param count 输出参数，实际读出的元素数量
+     * @return 读取结果，OVERRUN时cursor之前（含本次读出）的元素有效，之后的元素已经丢失
+     */
+    ReadStatus read(std::uint64_t& cursor, T* out, std::size_t capacity, std::size_t& count) const {
+        count = 0;
+        const std::uint64_t last = lastPublished();
+        if (cursor < m_firstSequence || cursor > last + 1) {
+            return ReadStatus::OVERRUN;
+        }
+        // 最旧的保留元素已越过读取位置
+        if (last >= m_capacity && cursor <= last - m_capacity) {
+            return ReadStatus::OVERRUN;
+        }
+
+        while (count < capacity && cursor <= last) {
+            const Slot& slot = m_slots[cursor & m_mask];
+            const std::uint64_t before = slot.stamp.load(std::memory_order_acquire);
+            if (before != 2 * cursor) {
+                return ReadStatus::OVERRUN;
+            }
+            std::uint64_t words[kWords];
+            for (std::size_t i = 0; i < kWords; ++i) {
+                words[i] = slot.words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.stamp.load(std::memory_order_relaxed) != before) {
+                return ReadStatus::OVERRUN;
+            }
+            std::memcpy(&out[count], words, sizeof(T));
+            ++count;
+            ++cursor;
+        }
+        return ReadStatus::OK;
+    }
+
+private:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    // 每个槽位独占缓存行，读者不会与写者在相邻槽位上伪共享
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> stamp{0};       ///< 顺序锁印记
+        std::atomic<std::uint64_t> words[kWords];  ///< 元素内容
+    };
+
+    static std::size_t roundUpPow2(std::size_t value) {
+        std::size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const std::size_t m_capacity;               ///< 容量（2的幂）
+    const std::size_t m_mask;                   ///< 下标掩码
+    const std::uint64_t m_firstSequence;        ///< 第一个元素的序号
+    std::unique_ptr<Slot[]> m_slots;            ///< 槽位数组
+    alignas(64) std::atomic<std::uint64_t> m_lastPublished; ///< 最近发布的序号
+};
@@ -0,0 +1,141 @@
+/**
+ * @file CallbackDispatcher.h
+ * @brief 异步回调派发器头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了将警告/故障回调从检查循环中剥离的异步派发器。
+ * 检查线程只把状态跳变事件放入有界无锁队列，由专用派发线程调用用户回调，
+ * 慢回调不再阻塞信号检测。
+ */
+
+#pragma once
+
+#include "BoundedQueue.h"
+#include "WakeupGate.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct SignalInfo;
+enum class SignalState;
+
+/**
+ * @brief 派发队列满时的处理策略
+ *
+ * - DROP:  丢弃新事件并计数，检查线程从不等待（默认）
+ * - BLOCK: 检查线程等待队列出现空位，保证不丢事件
+ */
+enum class OverflowPolicy {
+    DROP = 0,  ///< 丢弃新事件
+    BLOCK      ///< 阻塞等待空位
+};
+
+/**
+ * @brief 回调派发统计
+ */
+struct DispatchStats {
+    std::uint64_t submitted{0};   ///< 提交的事件数
+    std::uint64_t delivered{0};   ///< 已调用回调的事件数
+    std::uint64_t dropped{0};     ///< 因队列满被丢弃的事件数
+    std::uint64_t blocked{0};     ///< 因队列满而等待的入队次数
+    std::uint64_t exceptions{0};  ///< 回调抛出异常的次数
+};
+
+/**
+ * @brief 异步回调派发器
+ *
+ * 每个派发线程拥有一条独立的有界队列（通道），信号按其地址固定映射到某条通道，
+ * 因此同一信号的回调严格按提交顺序执行，不同信号之间可以并行。
+ *
+ * 未启动派发线程时，dispatch()直接在调用线程上执行回调。
+ * start()/stop()不可与dispatch()并发调用；dispatch()可由多个检查线程并发调用。
+ */
+class CallbackDispatcher {
+public:
+    CallbackDispatcher() = default;
+
+    /**
+     * @brief 析构函数
+     * 投递完队列中剩余事件后停止派发线程
+     */
+    ~CallbackDispatcher();
+
+    CallbackDispatcher(const CallbackDispatcher&) = delete;            ///< 禁用拷贝构造
+    CallbackDispatcher& operator=(const CallbackDispatcher&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 启动派发线程
+     * @param threadCount 派发线程（通道）数量，0表示停止异步派发
+     * @param queueCapacity 每条通道的队列容量
+     * @param policy 队列满时的处理策略
+     *
+     * 已在运行时先停止并投递完旧队列中的事件
+     */
+    void start(unsigned threadCount, std::size_t queueCapacity, OverflowPolicy policy);
+
+    /**
+     * @brief 停止派发线程
+     *
+     * 队列中剩余的事件会在线程退出前全部投递
+     */
+    void stop();
+
+    /**
+     * @brief 是否处于异步派发状态
+     */
+    bool active() const { return !m_lanes.empty(); }
+
+    /**
+     * @brief 派发一次状态跳变回调
+     * @param signal 发生跳变的信号
+     * @param state 跳变后的状态（WARNING或FAULT）
+     * @param value 触发跳变时的信号值
+     */
+    void dispatch(SignalInfo& signal, SignalState state, double value);
+
+    /**
+     * @brief 获取派发统计
+     */
+    DispatchStats stats() const;
+
+private:
+    /**
+     * @brief 派发事件
+     */
+    struct Event {
+        std::shared_ptr<SignalInfo> signal;  ///< 信号（延长生命周期直至回调完成）
+        SignalState state{};                 ///< 跳变后的状态
+        double value{0.0};                   ///< 触发值
+    };
+
+    /**
+     * @brief 派发通道
+     */
+    struct Lane {
+        explicit Lane(std::size_t capacity) : queue(capacity) {}
+
+        BoundedQueue<Event> queue;             ///< 事件队列
+        WakeupGate gate;                       ///< 派发线程的休眠门
+        std::thread thread;                    ///< 派发线程
+    };
+
+    void laneLoop(Lane& lane);
+    void deliver(const SignalInfo& signal, SignalState state, double value);
+
+private:
+    std::vector<std::unique_ptr<Lane>> m_lanes;  ///< 派发通道
+    OverflowPolicy m_policy{OverflowPolicy::DROP}; ///< 溢出策略
+    std::atomic<bool> m_stopping{false};         ///< 停止标志
+
+    std::atomic<std::uint64_t> m_submitted{0};   ///< 提交计数
+    std::atomic<std::uint64_t> m_delivered{0};   ///< 投递计数
+    std::atomic<std::uint64_t> m_dropped{0};     ///< 丢弃计数
+    std::atomic<std::uint64_t> m_blocked{0};     ///< 等待计数
+    std::atomic<std::uint64_t> m_exceptions{0};  ///< 回调异常计数
+};
@@ -0,0 +1,98 @@
+/**
+ * @file Clock.h
+ * @brief 监控时钟抽象头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了监控器读取当前时间所用的时钟：
+ * 默认使用steady_clock；测试与回放时注入虚拟时钟，由调用者推进时间，
+ * 状态机（tc等待期、ts持续时间、采样网格）全部按该时钟计时。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+/**
+ * @brief 时钟接口
+ *
+ * 时间点与steady_clock同类型，推送样本的源时间戳与虚拟时间可以直接比较
+ */
+class Clock {
+public:
+    using time_point = std::chrono::steady_clock::time_point;  ///< 时间点类型
+
+    virtual ~Clock() = default;
+
+    /**
+     * @brief 读取当前时间，可被任意线程调用
+     */
+    virtual time_point now() const = 0;
+
+    /**
+     * @brief 是否随真实时间流逝（只有真实时钟可以驱动后台监控线程按截止时间休眠）
+     */
+    virtual bool isRealTime() const = 0;
+};
+
+/**
+ * @brief 真实时钟（steady_clock）
+ */
+class SteadyClock final : public Clock {
+public:
+    time_point now() const override { return std::chrono::steady_clock::now(); }
+    bool isRealTime() const override { return true; }
+
+    /**
+     * @brief 获取共享实例
+     */
+    static const std::shared_ptr<SteadyClock>& instance() {
+        static const std::shared_ptr<SteadyClock> clock = std::make_shared<SteadyClock>();
+        return clock;
+    }
+};
+
+/**
+ * @brief 虚拟时钟
+ *
+ * 时间只在调用set()/advance()时前进，且从不后退；读取无锁
+ */
+class VirtualClock final : public Clock {
+public:
+    /**
+     * @brief 构造虚拟时钟
+     * @param start 起始时间；回放录制数据时应取录制的起始时间，使注册时间与tc等待期与录制时一致
+     */
+    explicit VirtualClock(time_point start = time_point{}) : m_now(start.time_since_epoch().count()) {}
+
+    time_point now() const override {
+        return time_point(time_point::duration(m_now.load(std::memory_order_acquire)));
+    }
+    bool isRealTime() const override { return false; }
+
+    /**
+     * @brief 将时间设置为指定时间点，早于当前时间时不变
+     */
+    void set(time_point timePoint) {
+        const time_point::rep target = timePoint.time_since_epoch().count();
+        time_point::rep current = m_now.load(std::memory_order_relaxed);
+        while (current < target &&
+               !m_now.compare_exchange_weak(current, target, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief 将时间向前推进指定时长
+     */
+    void advance(time_point::duration duration) {
+        if (duration > time_point::duration::zero()) {
+            m_now.fetch_add(duration.count(), std::memory_order_release);
+        }
+    }
+
+private:
+    std::atomic<time_point::rep> m_now;  ///< 当前时间（steady_clock计数）
+};
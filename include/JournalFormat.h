@@ -0,0 +1,101 @@
+/**
+ * @file JournalFormat.h
+ * @brief 事件日志文件格式头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了事件日志（journal）文件的二进制格式，由写入端与读取库共用。
+ * 日志由若干预分配大小的段文件组成，文件名为<prefix>-<8位序号>.tcj。
+ * 每个段文件以64字节的文件头开始，其后是按8字节对齐、首尾相接的变长记录；
+ * 记录长度为0表示已写入数据的末尾（预分配部分全为0）。
+ * 所有整数均为本机字节序，时间戳为steady_clock纳秒（与监控器其余接口一致）。
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief 段文件头（64字节）
+ *
+ * steadyOriginNs与wallOriginNs是创建段时同一时刻的两个时钟读数，用于把记录中的时间戳换算为墙上时间
+ */
+struct JournalFileHeader {
+    static constexpr std::uint64_t kMagic = 0x314c4e524a4354ull;  ///< 魔数（"TCJRNL1"）
+    static constexpr std::uint32_t kVersion = 1;                  ///< 格式版本
+
+    std::uint64_t magic;           ///< 魔数
+    std::uint32_t version;         ///< 格式版本
+    std::uint32_t headerBytes;     ///< 文件头长度，记录从此偏移开始
+    std::uint64_t segmentIndex;    ///< 段序号
+    std::int64_t steadyOriginNs;   ///< 创建时的steady_clock时间（纳秒）
+    std::int64_t wallOriginNs;     ///< 创建时的system_clock时间（纳秒，Unix纪元）
+    std::uint8_t reserved[24];     ///< 保留，为0
+};
+
+static_assert(sizeof(JournalFileHeader) == 64, "日志文件头须为64字节");
+
+/**
+ * @brief 记录类型
+ */
+enum class JournalRecordType : std::uint16_t {
+    SIGNAL = 1,      ///< 信号句柄与ID的对应关系（注册或启用日志时写入）
+    TRANSITION = 2,  ///< 状态迁移
+    SAMPLE = 3       ///< 参与分类的原始样本
+};
+
+/**
+ * @brief 记录头（所有记录的前8字节）
+ */
+struct JournalRecordHeader {
+    std::uint32_t size;      ///< 记录总长度（含记录头，8的倍数），0表示数据末尾
+    std::uint16_t type;      ///< 记录类型（JournalRecordType）
+    std::uint16_t reserved;  ///< 保留，为0
+};
+
+/**
+ * @brief 信号记录，其后紧跟idLength字节的信号ID（不含'\0'，补0至8字节对齐）
+ */
+struct JournalSignalRecord {
+    JournalRecordHeader header;  ///< 记录头
+    std::uint64_t handle;        ///< 信号句柄（SignalHandle::toValue()）
+    std::uint32_t idLength;      ///< 信号ID长度
+    std::uint32_t reserved;      ///< 保留，为0
+};
+
+/**
+ * @brief 状态迁移记录
+ */
+struct JournalTransitionRecord {
+    JournalRecordHeader header;  ///< 记录头
+    std::uint8_t oldState;       ///< 迁移前状态（SignalState）
+    std::uint8_t newState;       ///< 迁移后状态（SignalState）
+    std::uint8_t reserved[6];    ///< 保留，为0
+    std::uint64_t handle;        ///< 信号句柄
+    std::int64_t timestampNs;    ///< 样本时间
+    double value;                ///< 触发迁移的样本值
+};
+
+/**
+ * @brief 原始样本记录
+ */
+struct JournalSampleRecord {
+    JournalRecordHeader header;  ///< 记录头
+    std::uint64_t handle;        ///< 信号句柄
+    std::int64_t timestampNs;    ///< 样本时间
+    double value;                ///< 样本值
+};
+
+static_assert(sizeof(JournalRecordHeader) == 8, "记录头须为8字节");
+static_assert(sizeof(JournalSignalRecord) == 24, "信号记录布局不符");
+static_assert(sizeof(JournalTransitionRecord) == 40, "状态迁移记录布局不符");
+static_assert(sizeof(JournalSampleRecord) == 32, "样本记录布局不符");
+
+/**
+ * @brief 将长度向上取整为记录对齐（8字节）
+ */
+constexpr std::size_t journalAlign(std::size_t bytes) {
+    return (bytes + 7) & ~static_cast<std::size_t>(7);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file JournalReader.h
+ * @brief 事件日志读取库头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了事件日志的读取库，供事后分析使用：
+ * 按序号列出目录中的段文件，以只读内存映射顺序扫描记录，并按类型、信号、状态与时间过滤。
+ * 读取库只依赖JournalFormat.h，不依赖监控器本身。
+ */
+
+#pragma once
+
+#include "JournalFormat.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief 解码后的日志记录
+ *
+ * signalId指向映射中的原始字节（不以'\0'结尾），在读取器存续期间有效；仅SIGNAL记录有效
+ */
+struct JournalEvent {
+    JournalRecordType type{JournalRecordType::TRANSITION};  ///< 记录类型
+    std::uint64_t handle{0};                                ///< 信号句柄
+    std::int64_t timestampNs{0};                            ///< 样本时间（steady_clock纳秒）
+    double value{0.0};                                      ///< 样本值
+    std::uint8_t oldState{0};                               ///< 迁移前状态（仅TRANSITION）
+    std::uint8_t newState{0};                               ///< 迁移后状态（仅TRANSITION）
+    const char* signalId{nullptr};                          ///< 信号ID（仅SIGNAL）
+    std::uint32_t signalIdLength{0};                        ///< 信号ID长度（仅SIGNAL）
+};
+
+/**
+ * @brief 段文件信息
+ */
+struct JournalSegmentInfo {
+    std::string path;         ///< 文件路径
+    std::uint64_t index{0};   ///< 段序号
+};
+
+/**
+ * @brief 记录过滤条件
+ *
+ * 各条件之间为"与"关系；集合为空表示不按该条件过滤
+ */
+struct JournalFilter {
+    std::uint32_t typeMask{~0u};                ///< 接受的记录类型（按1 << type置位）
+    std::unordered_set<std::uint64_t> handles;  ///< 接受的信号句柄
+    std::uint32_t newStateMask{~0u};            ///< 接受的迁移后状态（按1 << state置位，仅作用于TRANSITION）
+    std::int64_t fromNs{INT64_MIN};             ///< 最早样本时间（含）
+    std::int64_t toNs{INT64_MAX};               ///< 最晚样本时间（不含）
+
+    /**
+     * @brief 检查记录是否满足过滤条件（SIGNAL记录只按类型与句柄过滤）
+     */
+    bool matches(const JournalEvent& event) const {
+        if (!(typeMask & (1u << static_cast<unsigned>(event.type)))) {
+            return false;
+        }
+        if (!handles.empty() && handles.find(event.handle) == handles.end()) {
+            return false;
+        }
+        if (event.type == JournalRecordType::SIGNAL) {
+            return true;
+        }
+        if (event.timestampNs < fromNs || event.timestampNs >= toNs) {
+            return false;
+        }
+        return event.type != JournalRecordType::TRANSITION || (newStateMask & (1u << event.newState));
+    }
+};
+
+/**
+ * @brief 单个段文件的读取器
+ */
+class JournalReader {
+public:
+    /**
+     * @brief 列出目录中指定前缀的段文件
+     * @return 按段序号升序排列的段文件
+     */
+    static std::vector<JournalSegmentInfo> listSegments(const std::string& directory,
+                                                        const std::string& prefix = "journal");
+
+    /**
+     * @brief 打开段文件
+     * @param path 文件路径
+     * @return 读取器，文件无法打开或文件头无效时返回空指针（errno指示原因）
+     */
+    static std::unique_ptr<JournalReader> open(const std::string& path);
+
+    ~JournalReader();
+
+    JournalReader(const JournalReader&) = delete;            ///< 禁用拷贝构造
+    JournalReader& operator=(const JournalReader&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 获取文件头
+     */
+    const JournalFileHeader& header() const { return *reinterpret_cast<const JournalFileHeader*>(m_base); }
+
+    /**
+     * @brief 读取下一条记录
+     * @return 到达数据末尾或遇到损坏的记录时返回false
+     */
+    bool next(JournalEvent& event);
+
+    /**
+     * @brief 读取下一条满足过滤条件的记录
+     */
+    bool next(JournalEvent& event, const JournalFilter& filter) {
+        while (next(event)) {
+            if (filter.matches(event)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 将steady_clock时间戳换算为墙上时间（Unix纪元纳秒）
+     */
+    std::int64_t toWallNs(std::int64_t timestampNs) const {
+        return header().wallOriginNs + (timestampNs - header().steadyOriginNs);
+    }
+
+private:
+    JournalReader(const char* base, std::size_t size);
+
+    const char* m_base{nullptr};  ///< 映射起始地址
+    std::size_t m_size{0};        ///< 映射长度
+    std::size_t m_offset{0};      ///< 读取位置
+};
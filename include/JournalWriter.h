@@ -0,0 +1,126 @@
+/**
+ * @file JournalWriter.h
+ * @brief 事件日志写入端头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了事件日志的写入端：记录经内存映射直接写入预分配的段文件，
+ * 写满后轮转到下一个段文件，并按保留数量删除最旧的段。
+ * 写入只是内存拷贝，只有轮转时才有文件系统调用。格式见JournalFormat.h。
+ */
+
+#pragma once
+
+#include "JournalFormat.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief 事件日志配置
+ */
+struct JournalConfig {
+    std::string directory;                 ///< 段文件目录，不存在时创建
+    std::string prefix{"journal"};         ///< 段文件名前缀
+    std::size_t segmentBytes{64u << 20};   ///< 单个段文件的预分配大小（字节），至少4KB
+    std::size_t maxSegments{0};            ///< 最多保留的段文件数，0表示不删除
+    bool recordSamples{false};             ///< 是否同时记录每个参与分类的原始样本
+};
+
+/**
+ * @brief 事件日志统计
+ */
+struct JournalStats {
+    bool enabled{false};          ///< 日志是否启用
+    std::uint64_t records{0};     ///< 已写入的记录数
+    std::uint64_t bytes{0};       ///< 已写入的字节数（不含文件头与预分配空间）
+    std::uint64_t segments{0};    ///< 已创建的段文件数
+    std::uint64_t dropped{0};     ///< 因创建段文件失败或单条记录超过段大小而丢弃的记录数
+};
+
+/**
+ * @brief 事件日志写入端
+ *
+ * append*()只能由一个线程调用；stats()可被任意线程调用。
+ * 析构时将当前段文件截断到实际写入的长度。
+ */
+class JournalWriter {
+public:
+    /**
+     * @brief 创建写入端并映射第一个段文件
+     * @param config 日志配置
+     * @return 写入端，目录或段文件无法创建时返回空指针（errno指示原因）
+     *
+     * 段序号接续目录中已有的同前缀段文件，不会覆盖之前的日志
+     */
+    static std::unique_ptr<JournalWriter> open(const JournalConfig& config);
+
+    ~JournalWriter();
+
+    JournalWriter(const JournalWriter&) = delete;            ///< 禁用拷贝构造
+    JournalWriter& operator=(const JournalWriter&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 获取配置
+     */
+    const JournalConfig& config() const { return m_config; }
+
+    /**
+     * @brief 写入信号句柄与ID的对应关系
+     *
+     * 对应关系同时保留在写入端，每个新段文件开头重新写入全部现存信号，
+     * 使删除旧段后每个段文件仍可单独解析
+     */
+    void appendSignal(std::uint64_t handle, const std::string& signalId);
+
+    /**
+     * @brief 信号移除后不再在新段文件开头写入其对应关系
+     */
+    void forgetSignal(std::uint64_t handle);
+
+    /**
+     * @brief 写入状态迁移
+     */
+    void appendTransition(std::uint64_t handle, std::uint8_t oldState, std::uint8_t newState, double value,
+                          std::chrono::steady_clock::time_point timestamp);
+
+    /**
+     * @brief 写入原始样本
+     */
+    void appendSample(std::uint64_t handle, double value, std::chrono::steady_clock::time_point timestamp);
+
+    /**
+     * @brief 获取统计
+     */
+    JournalStats stats() const;
+
+private:
+    explicit JournalWriter(const JournalConfig& config);
+
+    char* reserve(std::size_t bytes);
+    void commit(char* record, JournalRecordType type, std::size_t bytes);
+    void writeSignal(char* record, std::size_t bytes, std::uint64_t handle, const std::string& signalId);
+    bool openSegment(std::size_t reserveBytes = sizeof(JournalTransitionRecord));
+    void closeSegment();
+
+private:
+    JournalConfig m_config;                 ///< 日志配置
+    std::uint64_t m_nextIndex{0};           ///< 下一个段文件的序号
+    std::deque<std::string> m_segments;     ///< 现存的段文件路径（从旧到新）
+    int m_fd{-1};                           ///< 当前段文件描述符
+    char* m_base{nullptr};                  ///< 当前段文件的映射
+    std::size_t m_offset{0};                ///< 当前段文件的写入位置
+    bool m_failed{false};                   ///< 段文件创建失败后停止写入
+    std::unordered_map<std::uint64_t, std::string> m_signals;  ///< 现存信号的句柄与ID
+
+    std::atomic<std::uint64_t> m_records{0};  ///< 已写入的记录数
+    std::atomic<std::uint64_t> m_bytes{0};    ///< 已写入的字节数
+    std::atomic<std::uint64_t> m_created{0};  ///< 已创建的段文件数
+    std::atomic<std::uint64_t> m_dropped{0};  ///< 丢弃的记录数
+};
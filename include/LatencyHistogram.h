@@ -0,0 +1,218 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief 无锁对数线性延迟直方图与低开销计时头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了热点路径统计使用的计时源与直方图。
+ * 直方图按2的幂分段，每段再线性等分为2^SubBits个桶，
+ * 记录只涉及少量relaxed原子操作，读取方随时可取快照。
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TC_CYCLE_CLOCK_TSC 1
+#endif
+
+/**
+ * @brief 低开销计时源
+ *
+ * x86平台读取时间戳计数器（要求恒定频率TSC，现代处理器均满足），
+ * 由calibrate()对照steady_clock换算为纳秒；其他平台直接使用steady_clock。
+ */
+class CycleClock {
+public:
+    /**
+     * @brief 读取当前计数
+     */
+    static std::uint64_t now() {
+#if defined(TC_CYCLE_CLOCK_TSC)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief 将两次计数之差换算为纳秒
+     */
+    static std::uint64_t toNs(std::uint64_t ticks) {
+#if defined(TC_CYCLE_CLOCK_TSC)
+        return static_cast<std::uint64_t>(static_cast<double>(ticks) * nsPerTick().load(std::memory_order_relaxed));
+#else
+        return ticks;
+#endif
+    }
+
+    /**
+     * @brief 校准计数频率（阻塞约20毫秒），在启用统计时调用一次即可
+     */
+    static void calibrate() {
+#if defined(TC_CYCLE_CLOCK_TSC)
+        auto wallStart = std::chrono::steady_clock::now();
+        std::uint64_t tickStart = now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        auto wallEnd = std::chrono::steady_clock::now();
+        std::uint64_t tickEnd = now();
+        double ns = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(wallEnd - wallStart).count());
+        if (tickEnd > tickStart) {
+            nsPerTick().store(ns / static_cast<double>(tickEnd - tickStart), std::memory_order_relaxed);
+        }
+#endif
+    }
+
+private:
+#if defined(TC_CYCLE_CLOCK_TSC)
+    static std::atomic<double>& nsPerTick() {
+        static std::atomic<double> ratio{1.0};
+        return ratio;
+    }
+#endif
+};
+
+/**
+ * @brief 直方图摘要（纳秒）
+ *
+ * 分位数取所在桶的上界（不超过最大值），相对误差不超过桶宽
+ */
+struct HistogramSummary {
+    std::uint64_t count{0};   ///< 样本数
+    std::uint64_t meanNs{0};  ///< 平均值
+    std::uint64_t maxNs{0};   ///< 最大值
+    std::uint64_t p50Ns{0};   ///< 50分位
+    std::uint64_t p90Ns{0};   ///< 90分位
+    std::uint64_t p99Ns{0};   ///< 99分位
+    std::uint64_t p999Ns{0};  ///< 99.9分位
+};
+
+/**
+ * @brief 无锁对数线性直方图
+ *
+ * 小于2^SubBits的值各占一个桶；更大的值按最高位所在的2的幂分段，
+ * 每段线性等分为2^SubBits个桶，相对误差约为2^-SubBits。超过2^kMaxExponent的值计入最后一个桶。
+ *
+ * record()可被多个线程同时调用；recordExclusive()要求同一时刻只有一个写入者，
+ * 以普通读写代替原子读改写，开销更低。读取方可与写入方并发调用summary()。
+ *
+ * @tparam SubBits 每个2的幂分段的线性细分位数
+ */
+template <unsigned SubBits>
+class LogLinearHistogram {
+public:
+    static constexpr unsigned kMaxExponent = 40;                ///< 可区分的最大值约为2^40纳秒（约18分钟）
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << SubBits;
+    static constexpr std::size_t kBucketCount = (kMaxExponent - SubBits + 2) * kSubBuckets;
+
+    /**
+     * @brief 记录一个样本（多写入者安全）
+     */
+    void record(std::uint64_t value) {
+        m_buckets[indexOf(value)].fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+        std::uint64_t currentMax = m_max.load(std::memory_order_relaxed);
+        while (value > currentMax &&
+               !m_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief 记录一个样本（调用者保证单一写入者）
+     */
+    void recordExclusive(std::uint64_t value) {
+        bump(m_buckets[indexOf(value)], 1);
+        bump(m_sum, value);
+        if (value > m_max.load(std::memory_order_relaxed)) {
+            m_max.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 计算当前摘要
+     */
+    HistogramSummary summary() const {
+        HistogramSummary result;
+        std::uint64_t counts[kBucketCount];
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        result.count = total;
+        if (total == 0) {
+            return result;
+        }
+        result.maxNs = m_max.load(std::memory_order_relaxed);
+        // 样本和与各桶非同时读取，并发写入时平均值只是近似
+        result.meanNs = m_sum.load(std::memory_order_relaxed) / total;
+        result.p50Ns = percentile(counts, total, 500, result.maxNs);
+        result.p90Ns = percentile(counts, total, 900, result.maxNs);
+        result.p99Ns = percentile(counts, total, 990, result.maxNs);
+        result.p999Ns = percentile(counts, total, 999, result.maxNs);
+        return result;
+    }
+
+    /**
+     * @brief 计算值所在的桶
+     */
+    static std::size_t indexOf(std::uint64_t value) {
+        if (value < kSubBuckets) {
+            return static_cast<std::size_t>(value);
+        }
+        unsigned exponent = 63u - static_cast<unsigned>(__builtin_clzll(value));
+        if (exponent > kMaxExponent) {
+            return kBucketCount - 1;
+        }
+        std::size_t sub = static_cast<std::size_t>(value >> (exponent - SubBits)) & (kSubBuckets - 1);
+        return (exponent - SubBits + 1) * kSubBuckets + sub;
+    }
+
+    /**
+     * @brief 计算桶的上界（不含）
+     */
+    static std::uint64_t upperBoundOf(std::size_t index) {
+        if (index < kSubBuckets) {
+            return index + 1;
+        }
+        unsigned exponent = static_cast<unsigned>(index / kSubBuckets) + SubBits - 1;
+        std::uint64_t sub = index % kSubBuckets;
+        return (kSubBuckets + sub + 1) << (exponent - SubBits);
+    }
+
+private:
+    static void bump(std::atomic<std::uint64_t>& counter, std::uint64_t delta) {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    static std::uint64_t percentile(const std::uint64_t* counts, std::uint64_t total,
+                                    std::uint64_t perMille, std::uint64_t maxValue) {
+        std::uint64_t rank = (total * perMille + 999) / 1000;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return std::min(upperBoundOf(i), maxValue);
+            }
+        }
+        return maxValue;
+    }
+
+    // 样本和与最大值放在桶数组之前，与所属结构体的其他计数器共享缓存行
+    std::atomic<std::uint64_t> m_sum{0};                      ///< 样本和
+    std::atomic<std::uint64_t> m_max{0};                      ///< 最大值
+    std::atomic<std::uint64_t> m_buckets[kBucketCount] = {};  ///< 各桶计数（样本数为各桶之和）
+};
+
+using LatencyHistogram = LogLinearHistogram<3>;        ///< 循环级直方图，相对误差约12.5%
+using CompactLatencyHistogram = LogLinearHistogram<2>; ///< 信号级直方图，相对误差约25%，内存约为前者一半
@@ -0,0 +1,183 @@
+/**
+ * @file Logger.h
+ * @brief 异步日志头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了容差监控器内部使用的异步日志。
+ * 日志在调用线程上格式化到定长记录中并压入有界无锁队列，
+ * 由后台写线程交给可替换的输出目标，调用线程不做任何流I/O。
+ * 低于编译期最低级别（TC_LOG_MIN_LEVEL）的日志宏展开为空。
+ */
+
+#pragma once
+
+#include "BoundedQueue.h"
+#include "WakeupGate.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// 日志级别数值，供预处理器比较使用
+#define TC_LOG_LEVEL_TRACE 0
+#define TC_LOG_LEVEL_DEBUG 1
+#define TC_LOG_LEVEL_INFO  2
+#define TC_LOG_LEVEL_WARN  3
+#define TC_LOG_LEVEL_ERROR 4
+#define TC_LOG_LEVEL_OFF   5
+
+// 编译期最低级别，低于该级别的日志宏不产生任何代码
+#ifndef TC_LOG_MIN_LEVEL
+#define TC_LOG_MIN_LEVEL TC_LOG_LEVEL_DEBUG
+#endif
+
+/**
+ * @brief 日志级别
+ */
+enum class LogLevel {
+    TRACE = TC_LOG_LEVEL_TRACE,  ///< 跟踪
+    DEBUG = TC_LOG_LEVEL_DEBUG,  ///< 调试
+    INFO = TC_LOG_LEVEL_INFO,    ///< 一般信息（默认运行期级别）
+    WARN = TC_LOG_LEVEL_WARN,    ///< 警告
+    ERROR = TC_LOG_LEVEL_ERROR,  ///< 错误
+    OFF = TC_LOG_LEVEL_OFF       ///< 关闭
+};
+
+/**
+ * @brief 日志记录
+ */
+struct LogRecord {
+    static constexpr std::size_t kMaxLength = 232;  ///< 消息最大长度（字节），超出部分被截断
+
+    LogLevel level{LogLevel::INFO};                 ///< 级别
+    std::chrono::system_clock::time_point time;     ///< 产生时间
+    std::uint32_t length{0};                        ///< 消息长度
+    char text[kMaxLength + 1]{};                    ///< 消息内容（以'\0'结尾）
+};
+
+/**
+ * @brief 日志输出目标
+ *
+ * 只在后台写线程上调用
+ */
+using LogSink = std::function<void(const LogRecord& record)>;
+
+/**
+ * @brief 异步日志
+ *
+ * 进程内唯一实例。队列满时新日志被丢弃并计数，调用线程从不阻塞。
+ * 默认输出目标将INFO及以下级别写到标准输出、WARN及以上写到标准错误。
+ */
+class Logger {
+public:
+    /**
+     * @brief 获取日志实例
+     */
+    static Logger& instance();
+
+    /**
+     * @brief 设置运行期最低级别
+     */
+    void setLevel(LogLevel level);
+
+    /**
+     * @brief 获取运行期最低级别
+     */
+    LogLevel level() const;
+
+    /**
+     * @brief 检查指定级别是否会被记录
+     */
+    bool enabled(LogLevel level) const {
+        return static_cast<int>(level) >= m_level.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 替换输出目标
+     * @param sink 新的输出目标，为空时恢复默认输出
+     */
+    void setSink(LogSink sink);
+
+    /**
+     * @brief 格式化并提交一条日志（printf风格）
+     */
+    void log(LogLevel level, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+    /**
+     * @brief 等待已提交的日志全部写出
+     */
+    void flush();
+
+    /**
+     * @brief 获取因队列满或输出目标抛出异常而丢弃的日志数量
+     */
+    std::uint64_t dropped() const;
+
+    Logger(const Logger&) = delete;            ///< 禁用拷贝构造
+    Logger& operator=(const Logger&) = delete; ///< 禁用拷贝赋值
+
+private:
+    Logger();
+    ~Logger();
+
+    void writerLoop();
+    void write(const LogRecord& record);
+
+    static constexpr std::size_t kQueueCapacity = 1024;  ///< 队列容量
+
+    BoundedQueue<LogRecord> m_queue{kQueueCapacity};  ///< 待写出的日志
+    std::atomic<int> m_level{TC_LOG_LEVEL_INFO};      ///< 运行期最低级别
+    std::atomic<std::uint64_t> m_submitted{0};        ///< 已入队的日志数
+    std::atomic<std::uint64_t> m_written{0};          ///< 已写出的日志数
+    std::atomic<std::uint64_t> m_dropped{0};          ///< 丢弃的日志数
+    std::atomic<bool> m_stopping{false};              ///< 停止标志
+    WakeupGate m_gate;                                ///< 写线程的休眠门
+    std::mutex m_mutex;                               ///< 输出目标与排空通知的互斥锁
+    std::condition_variable m_drained;                ///< 通知flush队列已排空
+    LogSink m_sink;                                   ///< 输出目标，为空时使用默认输出
+    std::thread m_writer;                             ///< 后台写线程
+};
+
+#define TC_LOG_AT(level, ...)                                   \
+    do {                                                        \
+        Logger& tcLogger = Logger::instance();                  \
+        if (tcLogger.enabled(level)) {                          \
+            tcLogger.log(level, __VA_ARGS__);                   \
+        }                                                       \
+    } while (0)
+
+#if TC_LOG_MIN_LEVEL <= TC_LOG_LEVEL_TRACE
+#define TC_LOG_TRACE(...) TC_LOG_AT(LogLevel::TRACE, __VA_ARGS__)
+#else
+#define TC_LOG_TRACE(...) ((void)0)
+#endif
+
+#if TC_LOG_MIN_LEVEL <= TC_LOG_LEVEL_DEBUG
+#define TC_LOG_DEBUG(...) TC_LOG_AT(LogLevel::DEBUG, __VA_ARGS__)
+#else
+#define TC_LOG_DEBUG(...) ((void)0)
+#endif
+
+#if TC_LOG_MIN_LEVEL <= TC_LOG_LEVEL_INFO
+#define TC_LOG_INFO(...) TC_LOG_AT(LogLevel::INFO, __VA_ARGS__)
+#else
+#define TC_LOG_INFO(...) ((void)0)
+#endif
+
+#if TC_LOG_MIN_LEVEL <= TC_LOG_LEVEL_WARN
+#define TC_LOG_WARN(...) TC_LOG_AT(LogLevel::WARN, __VA_ARGS__)
+#else
+#define TC_LOG_WARN(...) ((void)0)
+#endif
+
+#if TC_LOG_MIN_LEVEL <= TC_LOG_LEVEL_ERROR
+#define TC_LOG_ERROR(...) TC_LOG_AT(LogLevel::ERROR, __VA_ARGS__)
+#else
+#define TC_LOG_ERROR(...) ((void)0)
+#endif
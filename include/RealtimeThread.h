@@ -0,0 +1,80 @@
+/**
+ * @file RealtimeThread.h
+ * @brief 实时线程配置头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了监控线程的实时配置：实时调度策略与优先级、CPU亲和性、
+ * 内存锁定与栈预取，以及记录实际生效结果的报告。
+ * 仅Linux平台生效；实时调度与内存锁定通常需要CAP_SYS_NICE/CAP_IPC_LOCK权限或相应的rlimit。
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 线程调度策略
+ *
+ * - OTHER: 普通分时调度（默认）
+ * - FIFO:  实时先进先出调度（SCHED_FIFO）
+ * - RR:    实时时间片轮转调度（SCHED_RR）
+ */
+enum class SchedulingPolicy {
+    OTHER = 0,  ///< 普通分时调度
+    FIFO,       ///< SCHED_FIFO
+    RR          ///< SCHED_RR
+};
+
+/**
+ * @brief 实时线程配置
+ */
+struct RealtimeConfig {
+    SchedulingPolicy policy{SchedulingPolicy::OTHER};  ///< 调度策略
+    int priority{0};                                   ///< 实时优先级（FIFO/RR为1~99，OTHER时忽略）
+    std::vector<unsigned> cpus;                        ///< CPU亲和性，为空时不修改
+    bool lockMemory{false};                            ///< 是否以mlockall锁定进程当前及以后的内存
+    std::size_t prefaultStackBytes{0};                 ///< 预先触碰的栈空间（字节），0表示不预取，最大4MB
+};
+
+/**
+ * @brief 实时配置的实际生效结果
+ *
+ * 调度策略、优先级与CPU集合均为应用后从内核读回的值，错误码为对应系统调用的errno
+ */
+struct RealtimeReport {
+    bool applied{false};                               ///< 配置是否已应用
+    SchedulingPolicy policy{SchedulingPolicy::OTHER};  ///< 实际调度策略
+    int priority{0};                                   ///< 实际优先级
+    int schedulingError{0};                            ///< 设置调度策略失败时的errno
+    std::vector<unsigned> cpus;                        ///< 实际可运行的CPU
+    int affinityError{0};                              ///< 设置CPU亲和性失败时的errno
+    bool memoryLocked{false};                          ///< 内存是否已锁定
+    int memoryLockError{0};                            ///< mlockall失败时的errno
+    std::size_t stackPrefaulted{0};                    ///< 实际预取的栈空间（字节）
+};
+
+/**
+ * @brief 将实时配置应用到调用线程
+ * @param config 实时配置
+ * @return 实际生效结果
+ *
+ * 内存锁定作用于整个进程；调用线程之后创建的线程继承其调度策略与CPU亲和性
+ */
+RealtimeReport applyRealtimeConfig(const RealtimeConfig& config);
+
+/**
+ * @brief 设置线程的调度策略与优先级
+ * @param thread 线程的原生句柄
+ * @return 成功返回0，失败返回errno
+ */
+int setThreadScheduling(std::thread::native_handle_type thread, SchedulingPolicy policy, int priority);
+
+/**
+ * @brief 生成实时配置结果的单行描述（用于日志）
+ */
+std::string describeRealtimeReport(const RealtimeReport& report);
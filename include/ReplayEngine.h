@@ -0,0 +1,125 @@
+/**
+ * @file ReplayEngine.h
+ * @brief 录制数据回放引擎头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了回放引擎：将录制的（时间戳，信号，值）序列按时间顺序推送给使用虚拟时钟的监控器，
+ * 在样本之间按采样网格逐轮执行周期检查，经由与实时监控完全相同的状态机，
+ * 产生相同的回调、状态迁移事件与统计。时钟只在需要时跳转，回放速度只受CPU限制。
+ */
+
+#pragma once
+
+#include "ToleranceChecker.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 回放样本
+ */
+struct ReplaySample {
+    std::chrono::steady_clock::time_point timestamp;  ///< 样本时间
+    SignalHandle handle;                              ///< 监控器中的信号句柄
+    double value{0.0};                                ///< 样本值
+};
+
+/**
+ * @brief 回放统计
+ */
+struct ReplayStats {
+    std::uint64_t samples{0};   ///< 已推送的样本数
+    std::uint64_t unknown{0};   ///< 信号未注册而跳过的样本数
+    std::uint64_t late{0};      ///< 早于当前虚拟时间、按当前时间处理的样本数
+    std::uint64_t passes{0};    ///< 执行的检查轮数
+};
+
+/**
+ * @brief 回放引擎
+ *
+ * 监控器必须以VirtualClock构造且不启动后台监控线程。回放前应先注册信号；
+ * 为使tc等待期与录制时一致，虚拟时钟的起始时间应取录制的起始时间（见journalStartTime()）。
+ * 引擎存续期间监控器处于回放模式：配置了valueCallback、信号组或共享内存段的信号
+ * 只在回放的样本处评估，不会读取实时数据；纯推送信号在样本之间仍按采样网格沿用最近的值。
+ * 非线程安全，所有方法应在同一线程上调用
+ */
+class ReplayEngine {
+public:
+    /**
+     * @brief 创建回放引擎
+     * @param checker 使用VirtualClock的监控器，引擎存续期间必须有效
+     * @return 回放引擎，监控器未使用虚拟时钟或后台监控线程运行中时返回空指针
+     */
+    static std::unique_ptr<ReplayEngine> create(ToleranceChecker& checker);
+
+    /**
+     * @brief 析构函数
+     * 退出监控器的回放模式
+     */
+    ~ReplayEngine();
+
+    ReplayEngine(const ReplayEngine&) = delete;            ///< 禁用拷贝构造
+    ReplayEngine& operator=(const ReplayEngine&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 按顺序回放一批样本，可多次调用以分段输入
+     *
+     * 时间相同的样本在同一轮中评估；同一信号在同一时间的多个样本依次评估
+     */
+    void feed(const ReplaySample* samples, std::size_t count);
+
+    /**
+     * @brief 回放单个样本
+     */
+    void feed(const ReplaySample& sample) { feed(&sample, 1); }
+
+    /**
+     * @brief 回放事件日志中的原始样本
+     * @param directory 段文件目录（日志需以recordSamples录制）
+     * @param prefix 段文件名前缀
+     * @return 目录中没有可读取的段文件时返回false
+     *
+     * 日志中的信号按ID对应到本监控器已注册的同名信号，未注册的信号计入unknown
+     */
+    bool feedJournal(const std::string& directory, const std::string& prefix = "journal");
+
+    /**
+     * @brief 将虚拟时间推进到指定时间，依次执行其间到期的周期检查
+     */
+    void advanceTo(std::chrono::steady_clock::time_point target);
+
+    /**
+     * @brief 评估已推送但尚未评估的样本
+     */
+    void flush();
+
+    /**
+     * @brief 获取统计
+     */
+    const ReplayStats& stats() const { return m_stats; }
+
+    /**
+     * @brief 获取事件日志中第一条带时间的记录的时间，用作虚拟时钟的起始时间
+     * @return 起始时间，目录中没有带时间的记录时返回零值时间点
+     */
+    static std::chrono::steady_clock::time_point journalStartTime(const std::string& directory,
+                                                                  const std::string& prefix = "journal");
+
+private:
+    ReplayEngine(ToleranceChecker& checker, std::shared_ptr<VirtualClock> clock);
+
+    void push(const ReplaySample& sample);
+    void runPass();
+
+    ToleranceChecker& m_checker;                 ///< 被驱动的监控器
+    std::shared_ptr<VirtualClock> m_clock;       ///< 监控器的虚拟时钟
+    std::vector<std::uint32_t> m_batchMarks;     ///< 各槽位最近一次推送所在的批次
+    std::uint32_t m_batch{1};                    ///< 当前批次
+    bool m_pending{false};                       ///< 当前批次是否有未评估的样本
+    ReplayStats m_stats;                         ///< 回放统计
+};
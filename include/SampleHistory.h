@@ -0,0 +1,140 @@
+/**
+ * @file SampleHistory.h
+ * @brief 信号样本历史环形缓冲区头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了按信号保存最近N个（时间戳, 值）样本的定长环形缓冲区。
+ * 存储在注册时一次性分配并按缓存行对齐，检查线程写入时不再分配内存；
+ * 读者可以零拷贝地查看缓冲区（SampleHistoryView），也可以批量导出一致的副本。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief 历史样本
+ */
+struct HistorySample {
+    std::chrono::steady_clock::time_point timestamp;  ///< 样本时间（tc/ts计时所用的时间）
+    double value{0.0};                                ///< 信号值
+};
+
+class SampleHistory;
+
+/**
+ * @brief 样本历史的零拷贝视图
+ *
+ * 环形缓冲区回绕时，按时间从旧到新的样本分为first与second两段连续内存。
+ * 视图持有缓冲区的所有权，信号被移除后仍可安全访问；但检查线程会继续写入，
+ * 在非检查线程上使用时，读完后应调用intact()确认期间没有样本被覆盖。
+ */
+struct SampleHistoryView {
+    const HistorySample* first{nullptr};  ///< 较旧的一段
+    std::size_t firstCount{0};            ///< 较旧一段的样本数
+    const HistorySample* second{nullptr}; ///< 较新的一段
+    std::size_t secondCount{0};           ///< 较新一段的样本数
+    std::uint64_t oldestSequence{0};      ///< 视图中最旧样本的序号
+    std::shared_ptr<const SampleHistory> owner; ///< 所属缓冲区，为空表示信号未启用历史
+
+    /**
+     * @brief 样本总数
+     */
+    std::size_t size() const { return firstCount + secondCount; }
+
+    /**
+     * @brief 按时间顺序访问第index个样本（0为最旧）
+     */
+    const HistorySample& operator[](std::size_t index) const {
+        return index < firstCount ? first[index] : second[index - firstCount];
+    }
+
+    /**
+     * @brief 检查视图中的样本是否仍未被覆盖
+     */
+    bool intact() const;
+};
+
+/**
+ * @brief 定长样本历史环形缓冲区
+ *
+ * 单写者（检查该信号的线程），多读者。写者从不等待读者，最旧的样本被覆盖。
+ */
+class SampleHistory {
+public:
+    /**
+     * @brief 构造并预分配缓冲区
+     * @param capacity 保存的样本数，至少为1
+     */
+    explicit SampleHistory(std::size_t capacity);
+
+    SampleHistory(const SampleHistory&) = delete;            ///< 禁用拷贝构造
+    SampleHistory& operator=(const SampleHistory&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 计算指定容量的缓冲区占用的内存（字节）
+     */
+    static std::size_t footprint(std::size_t capacity);
+
+    /**
+     * @brief 获取容量
+     */
+    std::size_t capacity() const { return m_capacity; }
+
+    /**
+     * @brief 获取累计写入的样本数
+     */
+    std::uint64_t written() const { return m_written.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 追加样本（仅写者调用）
+     */
+    void record(std::chrono::steady_clock::time_point timestamp, double value) {
+        const std::uint64_t sequence = m_written.load(std::memory_order_relaxed);
+        m_claimed.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        HistorySample& slot = m_samples[sequence % m_capacity];
+        slot.timestamp = timestamp;
+        slot.value = value;
+        m_written.store(sequence + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief 获取当前内容的零拷贝视图
+     * @param self 指向本缓冲区的共享指针，由视图持有
+     */
+    static SampleHistoryView view(const std::shared_ptr<const SampleHistory>& self);
+
+    /**
+     * @brief 导出最近的样本（从旧到新）
+     * @param out 输出数组
+     * @param capacity 输出数组容量，小于已保存的样本数时只导出最新的部分
+     * @return 导出的样本数；复制期间被写者覆盖的最旧样本会被剔除
+     */
+    std::size_t copy(HistorySample* out, std::size_t capacity) const;
+
+    /**
+     * @brief 检查序号不小于sequence的样本是否仍在缓冲区中
+     */
+    bool retains(std::uint64_t sequence) const {
+        // 写者开始写入序号w时即覆盖序号w-capacity的样本
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return m_claimed.load(std::memory_order_relaxed) <= sequence + m_capacity;
+    }
+
+private:
+    struct AlignedDelete {
+        void operator()(HistorySample* samples) const;
+    };
+
+    const std::size_t m_capacity;                                 ///< 容量
+    std::unique_ptr<HistorySample[], AlignedDelete> m_samples;    ///< 按缓存行对齐的样本存储
+    alignas(64) std::atomic<std::uint64_t> m_written{0};          ///< 累计写入完成的样本数
+    std::atomic<std::uint64_t> m_claimed{0};                      ///< 累计开始写入的样本数
+};
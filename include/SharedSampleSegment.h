@@ -0,0 +1,139 @@
+/**
+ * @file SharedSampleSegment.h
+ * @brief 共享内存样本段头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了供进程外数据源写入样本的POSIX共享内存段。
+ * 段由头部和若干槽位组成，每个槽位保存一个信号的最近样本，以顺序锁保护：
+ * 生产者进程直接写入槽位，监控器每次采样直接从映射中读取，热路径上没有系统调用和数据拷贝。
+ * 生产者只需链接ToleranceSampleProducer库，不依赖监控器本身。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * @brief 共享内存段头部（位于映射起始处）
+ *
+ * magic在头部其余字段初始化完成后才以release写入，打开方以acquire读取并校验
+ */
+struct alignas(64) SharedSampleHeader {
+    std::atomic<std::uint64_t> magic;  ///< 魔数，初始化完成后写入
+    std::uint32_t version;             ///< 布局版本
+    std::uint32_t slotCount;           ///< 槽位数量
+};
+
+/**
+ * @brief 共享内存槽位
+ *
+ * 顺序锁：sequence为0表示从未写入，奇数表示正在写入，写完后为偶数。
+ * 每个槽位同一时刻只允许一个生产者写入；槽位独占缓存行，相邻槽位的写入互不干扰。
+ */
+struct alignas(64) SharedSampleSlot {
+    std::atomic<std::uint64_t> sequence;   ///< 顺序锁序号
+    std::atomic<std::uint64_t> valueBits;  ///< 信号值（double的位模式）
+    std::atomic<std::int64_t> timestamp;   ///< 样本的源时间戳（steady_clock计数，跨进程可比）
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "共享内存槽位要求64位原子操作无锁");
+static_assert(std::atomic<std::int64_t>::is_always_lock_free, "共享内存槽位要求64位原子操作无锁");
+
+/**
+ * @brief 从槽位读出的样本
+ */
+struct SharedSample {
+    double value{0.0};                                ///< 信号值
+    std::chrono::steady_clock::time_point timestamp;  ///< 源时间戳
+    std::uint64_t sequence{0};                        ///< 槽位序号，每次写入递增
+};
+
+/**
+ * @brief 共享内存样本段
+ *
+ * 生产者以create()创建段（或以open()附加到已有段）后调用publish()写入样本；
+ * 监控器以open()附加，并在SignalConfig中指定段与槽位。
+ * 对象析构时解除映射，但不删除段；段的名字由unlink()删除。
+ * 失败的工厂函数返回空指针，errno指示原因。
+ */
+class SharedSampleSegment {
+public:
+    static constexpr std::uint64_t kMagic = 0x4d48535443534d54ull;  ///< 魔数
+    static constexpr std::uint32_t kVersion = 1;                    ///< 布局版本
+
+    /**
+     * @brief 创建新的共享内存段
+     * @param name 段名（POSIX共享内存名，如"/tc_samples"）
+     * @param slotCount 槽位数量，须大于0
+     * @return 段对象，同名段已存在或创建失败时返回空指针
+     */
+    static std::shared_ptr<SharedSampleSegment> create(const std::string& name, std::uint32_t slotCount);
+
+    /**
+     * @brief 附加到已有的共享内存段
+     * @param name 段名
+     * @return 段对象，段不存在、尚未初始化完成或布局不兼容时返回空指针
+     */
+    static std::shared_ptr<SharedSampleSegment> open(const std::string& name);
+
+    /**
+     * @brief 删除共享内存段的名字
+     * @return 成功返回true；已映射的进程不受影响，直至解除映射
+     */
+    static bool unlink(const std::string& name);
+
+    ~SharedSampleSegment();
+
+    SharedSampleSegment(const SharedSampleSegment&) = delete;            ///< 禁用拷贝构造
+    SharedSampleSegment& operator=(const SharedSampleSegment&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 获取段名
+     */
+    const std::string& name() const { return m_name; }
+
+    /**
+     * @brief 获取槽位数量
+     */
+    std::uint32_t slotCount() const { return m_slotCount; }
+
+    /**
+     * @brief 写入样本（生产者调用）
+     * @param slot 槽位下标
+     * @param value 信号值
+     * @param timestamp 样本的源时间戳
+     * @return 槽位下标越界时返回false
+     *
+     * 无系统调用、无锁；同一槽位不可被多个线程或进程并发写入
+     */
+    bool publish(std::uint32_t slot, double value,
+                 std::chrono::steady_clock::time_point timestamp = std::chrono::steady_clock::now());
+
+    /**
+     * @brief 读取槽位的最近样本
+     * @param slot 槽位下标
+     * @param sample 输出参数
+     * @return 读到完整样本返回true；槽位从未写入、下标越界或多次重试仍与写入冲突时返回false
+     *
+     * 重试次数有上限，生产者在写入中途退出时读者不会被卡住
+     */
+    bool read(std::uint32_t slot, SharedSample& sample) const;
+
+private:
+    SharedSampleSegment(std::string name, void* mapping, std::size_t size);
+
+    static std::size_t mappingSize(std::uint32_t slotCount);
+
+    std::string m_name;                ///< 段名
+    void* m_mapping{nullptr};          ///< 映射起始地址
+    std::size_t m_size{0};             ///< 映射长度
+    std::uint32_t m_slotCount{0};      ///< 槽位数量（打开时从头部读出后不再读取共享内存）
+    SharedSampleSlot* m_slots{nullptr}; ///< 槽位数组
+};
@@ -0,0 +1,89 @@
+#ifndef SHARED_SAMPLE_SEGMENT_C_H
+#define SHARED_SAMPLE_SEGMENT_C_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 共享内存样本段（不透明类型），由tc_shm_create()或tc_shm_open()获得
+typedef struct tc_shm_segment tc_shm_segment_t;
+
+/**
+ * 重要说明：共享内存样本段
+ * 
+ * 生产者进程只需链接 ToleranceSampleProducer 库并包含本头文件：
+ * 1. 以 tc_shm_create() 创建段（或以 tc_shm_open() 附加到已有段），按约定的槽位写入样本
+ * 2. 每个槽位同一时刻只能有一个写者；写入不做系统调用，不加锁
+ * 3. 监控器进程以 tc_shm_open() 附加同名段，并在 tc_signal_config_t 中指定段与槽位
+ * 时间戳为 CLOCK_MONOTONIC 纳秒，同一主机上的进程之间可比。
+ */
+
+/**
+ * 创建新的共享内存段
+ * @param name 段名（POSIX共享内存名，如"/tc_samples"）
+ * @param slot_count 槽位数量，须大于0
+ * @return 段指针，同名段已存在或创建失败时返回NULL（errno指示原因）
+ */
+tc_shm_segment_t* tc_shm_create(const char* name, unsigned slot_count);
+
+/**
+ * 附加到已有的共享内存段
+ * @param name 段名
+ * @return 段指针，段不存在或布局不兼容时返回NULL（errno指示原因）
+ */
+tc_shm_segment_t* tc_shm_open(const char* name);
+
+/**
+ * 关闭段指针（解除本进程对段的引用，不删除段）
+ * 已用于注册信号的段在信号移除前仍保持映射
+ * @param segment 段指针，可为NULL
+ */
+void tc_shm_close(tc_shm_segment_t* segment);
+
+/**
+ * 删除共享内存段的名字（已附加的进程不受影响）
+ * @param name 段名
+ * @return 成功返回0，失败返回-1（errno指示原因）
+ */
+int tc_shm_unlink(const char* name);
+
+/**
+ * 获取段的槽位数量
+ * @param segment 段指针
+ * @return 槽位数量，segment为NULL时返回0
+ */
+unsigned tc_shm_slot_count(const tc_shm_segment_t* segment);
+
+/**
+ * 以当前时间写入样本
+ * @param segment 段指针
+ * @param slot 槽位下标
+ * @param value 信号值
+ * @return 成功返回0，segment为NULL或槽位越界时返回-1
+ */
+int tc_shm_publish(tc_shm_segment_t* segment, unsigned slot, double value);
+
+/**
+ * 以指定的源时间戳写入样本
+ * @param segment 段指针
+ * @param slot 槽位下标
+ * @param value 信号值
+ * @param timestamp_ns 样本的源时间戳（CLOCK_MONOTONIC纳秒）
+ * @return 成功返回0，segment为NULL或槽位越界时返回-1
+ */
+int tc_shm_publish_at(tc_shm_segment_t* segment, unsigned slot, double value, long long timestamp_ns);
+
+#ifdef __cplusplus
+}
+
+#include "SharedSampleSegment.h"
+
+// 不透明类型的实际定义，仅对C++可见，监控器C接口借此共享段的所有权
+struct tc_shm_segment {
+    std::shared_ptr<SharedSampleSegment> segment;  ///< 段对象
+};
+#endif
+
+#endif // SHARED_SAMPLE_SEGMENT_C_H
@@ -0,0 +1,103 @@
+/**
+ * @file SignalHotStore.h
+ * @brief 信号热数据存储与偏差分类内核头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了按结构数组（SoA）组织的信号热数据存储。
+ * 目标值、警告阈值、故障阈值、最近值和状态各自连续存放，
+ * 偏差分类由AVX2/NEON向量内核批量完成，不支持时回退到标量实现。
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 信号热数据存储
+ *
+ * 以信号句柄的槽位下标为索引。分类结果直接采用SignalState的取值：
+ * 1=NORMAL（偏差<=警告阈值）、2=WARNING（偏差<=故障阈值）、3=FAULT（其余情况，含NaN）。
+ *
+ * 非线程安全：阈值写入与扩容由监控线程在两轮检查之间完成，
+ * 检查期间各分片只读写属于自己信号的槽位。
+ */
+class SignalHotStore {
+public:
+    /**
+     * @brief 确保至少容纳指定数量的槽位
+     */
+    void reserveSlots(std::size_t slotCount);
+
+    /**
+     * @brief 设置槽位的目标值与阈值
+     */
+    void setThresholds(std::uint32_t slot, double target, double warningThreshold, double faultThreshold);
+
+    /**
+     * @brief 切换槽位用于分类的警告/故障阈值（滞回时由状态机按确认后的状态选择进入或退出阈值）
+     */
+    void setBandThresholds(std::uint32_t slot, double warningThreshold, double faultThreshold) {
+        m_warningThresholds[slot] = warningThreshold;
+        m_faultThresholds[slot] = faultThreshold;
+    }
+
+    /**
+     * @brief 访问槽位的最近值
+     */
+    double& lastValue(std::uint32_t slot) { return m_lastValues[slot]; }
+
+    /**
+     * @brief 访问槽位的状态镜像（SignalState取值）
+     */
+    std::uint8_t& state(std::uint32_t slot) { return m_states[slot]; }
+
+    /**
+     * @brief 按槽位列表分类
+     * @param slots 槽位下标数组
+     * @param count 槽位数量
+     * @param out 输出数组，存储各槽位最近值的分类结果
+     *
+     * 值与阈值均按槽位从存储中聚集读取
+     */
+    void classify(const std::uint32_t* slots, std::size_t count, std::uint8_t* out) const;
+
+    /**
+     * @brief 对整个存储做连续分类，结果写入状态镜像之外的输出数组
+     * @param out 输出数组，长度不小于slotCount()
+     */
+    void classifyAll(std::uint8_t* out) const;
+
+    /**
+     * @brief 获取槽位数量
+     */
+    std::size_t slotCount() const { return m_targets.size(); }
+
+    /**
+     * @brief 连续数组上的偏差分类内核
+     * @param values 信号值
+     * @param targets 目标值
+     * @param warningThresholds 警告阈值
+     * @param faultThresholds 故障阈值
+     * @param out 输出分类结果
+     * @param count 元素数量
+     */
+    static void classifyContiguous(const double* values, const double* targets,
+                                   const double* warningThresholds, const double* faultThresholds,
+                                   std::uint8_t* out, std::size_t count);
+
+    /**
+     * @brief 获取当前使用的分类内核名称（"avx2"、"neon"或"scalar"）
+     */
+    static const char* kernelName();
+
+private:
+    std::vector<double> m_targets;            ///< 目标值
+    std::vector<double> m_warningThresholds;  ///< 警告阈值
+    std::vector<double> m_faultThresholds;    ///< 故障阈值
+    std::vector<double> m_lastValues;         ///< 最近值
+    std::vector<std::uint8_t> m_states;       ///< 状态镜像
+};
@@ -0,0 +1,27 @@
+/**
+ * @file SignalState.h
+ * @brief 信号状态定义头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 信号状态由监控器、批量评估内核与静态信号集共用，单独定义以便不依赖监控器的场合只包含此文件。
+ */
+
+#pragma once
+
+/**
+ * @brief 信号状态枚举
+ * 
+ * 定义信号在监控过程中的四种可能状态：
+ * - UNKNOWN: 初始未知状态（注册后、tc等待期内）
+ * - NORMAL:  正常状态（偏差在警告阈值内）
+ * - WARNING: 警告状态（偏差超过警告阈值但未超过故障阈值）
+ * - FAULT:  故障状态（偏差超过故障阈值）
+ */
+enum class SignalState {
+    UNKNOWN = 0,  ///< 初始未知状态，注册后tc等待期内的状态
+    NORMAL,       ///< 正常状态，信号值在容差范围内
+    WARNING,      ///< 警告状态，信号值超出警告阈值
+    FAULT         ///< 故障状态，信号值超出故障阈值
+};
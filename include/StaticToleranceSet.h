@@ -0,0 +1,233 @@
+/**
+ * @file StaticToleranceSet.h
+ * @brief 编译期确定拓扑的静态信号集头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了固定拓扑设备使用的静态信号集：信号的目标值、阈值、tc与ts在编译期给定，
+ * 由模板生成完全内联、不分配内存、不经std::function的检查代码，语义与ToleranceChecker::checkSignal一致。
+ * 只依赖标准库与SignalState.h，无需链接任何库，适用于紧凑的控制循环与小型嵌入式目标。
+ *
+ * 信号以描述类型给出，例如：
+ * @code
+ * struct SpindleTemp {
+ *     static constexpr double targetValue = 60.0;
+ *     static constexpr double warningThreshold = 5.0;
+ *     static constexpr double faultThreshold = 10.0;
+ *     static constexpr int tcMs = 1000;
+ *     static constexpr int tsMs = 200;
+ * };
+ * StaticToleranceSet<SpindleTemp, CoolantPressure> machine(now);
+ * machine.evaluate<SpindleTemp>(value, now, handler);
+ * @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "SignalState.h"
+
+namespace static_tolerance_detail {
+
+template <typename T, typename... Ts>
+struct IndexOf;
+
+template <typename T, typename... Ts>
+struct IndexOf<T, T, Ts...> : std::integral_constant<std::size_t, 0> {};
+
+template <typename T, typename U, typename... Ts>
+struct IndexOf<T, U, Ts...> : std::integral_constant<std::size_t, 1 + IndexOf<T, Ts...>::value> {};
+
+template <typename T>
+struct IndexOf<T> {
+    static_assert(sizeof(T) == 0, "信号不属于该StaticToleranceSet");
+};
+
+template <typename T, typename... Ts>
+constexpr bool kUnique = (!std::is_same<T, Ts>::value && ...);
+
+template <typename... Ts>
+struct AllUnique : std::true_type {};
+
+template <typename T, typename... Ts>
+struct AllUnique<T, Ts...> : std::integral_constant<bool, kUnique<T, Ts...> && AllUnique<Ts...>::value> {};
+
+/**
+ * @brief 编译期检查信号描述
+ */
+template <typename Signal>
+constexpr bool validSignal() {
+    static_assert(std::is_same<std::decay_t<decltype(Signal::targetValue)>, double>::value,
+                  "信号描述需要static constexpr double targetValue");
+    static_assert(Signal::warningThreshold >= 0.0, "warningThreshold不能为负");
+    static_assert(Signal::faultThreshold >= Signal::warningThreshold, "faultThreshold不能小于warningThreshold");
+    static_assert(Signal::tcMs >= 0, "tcMs不能为负");
+    static_assert(Signal::tsMs >= 0, "tsMs不能为负");
+    return true;
+}
+
+} // namespace static_tolerance_detail
+
+/**
+ * @brief 不处理状态迁移的处理器
+ */
+struct IgnoreTransitions {
+    template <typename Signal>
+    void operator()(Signal, SignalState, double) const {}
+};
+
+/**
+ * @brief 编译期确定拓扑的静态信号集
+ * @tparam Signals 信号描述类型（各不相同），提供static constexpr成员
+ *         targetValue、warningThreshold、faultThreshold（double）与tcMs、tsMs（int）
+ *
+ * 状态保存在定长数组中，对象可放在栈上或静态存储区。
+ * 进入WARNING/FAULT时调用处理器handler(Signal{}, state, value)，对应ToleranceChecker的警告/故障回调；
+ * 处理器为模板参数，调用被内联。非线程安全
+ */
+template <typename... Signals>
+class StaticToleranceSet {
+    static_assert(sizeof...(Signals) > 0, "StaticToleranceSet至少需要一个信号");
+    static_assert(static_tolerance_detail::AllUnique<Signals...>::value, "信号描述类型不能重复");
+    static_assert((static_tolerance_detail::validSignal<Signals>() && ...), "信号描述无效");
+
+public:
+    using time_point = std::chrono::steady_clock::time_point;  ///< 时间点类型
+
+    /**
+     * @brief 信号数量
+     */
+    static constexpr std::size_t kSize = sizeof...(Signals);
+
+    /**
+     * @brief 信号描述类型在集合中的下标
+     */
+    template <typename Signal>
+    static constexpr std::size_t indexOf() {
+        return static_tolerance_detail::IndexOf<Signal, Signals...>::value;
+    }
+
+    /**
+     * @brief 构造信号集，所有信号的tc等待期自start开始
+     */
+    explicit StaticToleranceSet(time_point start = time_point{}) { reset(start); }
+
+    /**
+     * @brief 复位全部信号（UNKNOWN，tc等待期自start重新开始）
+     */
+    void reset(time_point start) {
+        for (auto& slot : m_slots) {
+            slot = Slot{};
+            slot.registrationTime = start;
+        }
+    }
+
+    /**
+     * @brief 评估单个信号
+     * @tparam Signal 信号描述类型
+     * @param value 信号值
+     * @param now 样本时间
+     * @param handler 进入WARNING/FAULT时的处理器
+     * @return 评估后的状态
+     */
+    template <typename Signal, typename Handler = IgnoreTransitions>
+    SignalState evaluate(double value, time_point now, Handler&& handler = Handler{}) {
+        return step<Signal>(m_slots[indexOf<Signal>()], value, now, handler);
+    }
+
+    /**
+     * @brief 按声明顺序评估全部信号
+     * @param values 信号值，values[i]对应第i个信号描述
+     * @param now 样本时间
+     * @param handler 进入WARNING/FAULT时的处理器
+     */
+    template <typename Handler = IgnoreTransitions>
+    void evaluateAll(const std::array<double, kSize>& values, time_point now, Handler&& handler = Handler{}) {
+        evaluateAll(values, now, handler, std::index_sequence_for<Signals...>{});
+    }
+
+    /**
+     * @brief 获取信号的当前状态
+     */
+    template <typename Signal>
+    SignalState state() const {
+        return m_slots[indexOf<Signal>()].state;
+    }
+
+    /**
+     * @brief 按下标获取信号的当前状态
+     */
+    SignalState state(std::size_t index) const { return m_slots[index].state; }
+
+private:
+    struct Slot {
+        SignalState state{SignalState::UNKNOWN};  ///< 当前状态
+        bool warningTimerActive{false};           ///< 警告计时是否开始
+        bool faultTimerActive{false};             ///< 故障计时是否开始
+        time_point registrationTime;              ///< tc等待期开始时间
+        time_point warningStartTime;              ///< 警告计时开始时间
+        time_point faultStartTime;                ///< 故障计时开始时间
+    };
+
+    template <typename Handler, std::size_t... Index>
+    void evaluateAll(const std::array<double, kSize>& values, time_point now, Handler& handler,
+                     std::index_sequence<Index...>) {
+        (step<Signals>(m_slots[Index], values[Index], now, handler), ...);
+    }
+
+    static std::int64_t elapsedMs(time_point now, time_point since) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(now - since).count();
+    }
+
+    // 与ToleranceChecker::settled/updateSignalState相同的状态机，阈值与时间均为编译期常量
+    template <typename Signal, typename Handler>
+    static SignalState step(Slot& slot, double value, time_point now, Handler& handler) {
+        if (elapsedMs(now, slot.registrationTime) < Signal::tcMs) {
+            return slot.state;  // 仍在等待期
+        }
+
+        const SignalState previous = slot.state;
+        SignalState current = previous;
+        const double deviation = std::abs(value - Signal::targetValue);
+        if (deviation <= Signal::warningThreshold) {
+            current = SignalState::NORMAL;
+            slot.warningTimerActive = slot.faultTimerActive = false;
+        } else if (deviation <= Signal::faultThreshold) {
+            slot.faultTimerActive = false;
+            if (!slot.warningTimerActive) {
+                slot.warningTimerActive = true;
+                slot.warningStartTime = now;
+            }
+            if (elapsedMs(now, slot.warningStartTime) >= Signal::tsMs) {
+                if (previous != SignalState::WARNING) {
+                    handler(Signal{}, SignalState::WARNING, value);
+                }
+                current = SignalState::WARNING;
+            }
+        } else {
+            // 含NaN：与分类内核一致，无法比较的值按故障处理
+            if (!slot.faultTimerActive) {
+                slot.faultStartTime = now;
+                slot.faultTimerActive = true;
+            }
+            if (elapsedMs(now, slot.faultStartTime) >= Signal::tsMs) {
+                if (previous != SignalState::FAULT) {
+                    handler(Signal{}, SignalState::FAULT, value);
+                }
+                current = SignalState::FAULT;
+            }
+        }
+        slot.state = current;
+        return current;
+    }
+
+    std::array<Slot, kSize> m_slots;  ///< 各信号的状态与计时
+};
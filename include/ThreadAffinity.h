@@ -0,0 +1,30 @@
+/**
+ * @file ThreadAffinity.h
+ * @brief 线程CPU亲和性工具头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了将监控器内部线程绑定到指定CPU核心的工具函数。
+ * 仅Linux平台生效，其他平台调用返回false。
+ */
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 设置线程的CPU亲和性
+ * @param thread 线程的原生句柄
+ * @param cpus 允许运行的CPU编号，为空时允许运行在所有CPU上
+ * @return 设置成功返回true
+ */
+bool setThreadAffinity(std::thread::native_handle_type thread, const std::vector<unsigned>& cpus);
+
+/**
+ * @brief 设置调用线程的CPU亲和性
+ * @param cpus 允许运行的CPU编号，为空时允许运行在所有CPU上
+ * @return 设置成功返回true
+ */
+bool setCurrentThreadAffinity(const std::vector<unsigned>& cpus);
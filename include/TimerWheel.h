@@ -0,0 +1,116 @@
+/**
+ * @file TimerWheel.h
+ * @brief 分层时间轮调度器头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了监控系统使用的分层时间轮（hierarchical timer wheel）。
+ * 每个信号按自身采样周期挂入时间轮，监控线程每次只唤醒到期的信号，
+ * 使CPU开销与实际采样率成正比，而与信号总数无关。
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief 分层时间轮
+ *
+ * 以毫秒为一个tick，共4层、每层64个槽，可直接表示约4.6小时内的到期时间，
+ * 更远的定时器先挂在最高层，级联时按真实到期时间重新放置。
+ *
+ * 特性：
+ * - 调度与取消均为O(1)，节点存放在连续的节点池中并复用
+ * - 每层维护64位占用位图，空槽在推进时可整段跳过
+ * - 非线程安全，由调用者负责加锁
+ */
+class TimerWheel {
+public:
+    using Tick = std::uint64_t;     ///< 时间刻度（毫秒）
+    using TimerId = std::uint32_t;  ///< 定时器标识符
+
+    static constexpr TimerId kInvalidTimer = 0xFFFFFFFFu;  ///< 无效定时器标识
+    static constexpr Tick kNoExpiry = ~Tick{0};            ///< 时间轮为空时的下次到期时间
+
+    /**
+     * @brief 构造时间轮
+     * @param currentTick 起始时间刻度
+     */
+    explicit TimerWheel(Tick currentTick = 0);
+
+    /**
+     * @brief 调度定时器
+     * @param expiry 到期时间刻度，早于或等于当前刻度时在下一次推进时到期
+     * @param cookie 用户数据，到期时原样返回
+     * @return 定时器标识符，可用于取消
+     */
+    TimerId schedule(Tick expiry, std::uint64_t cookie);
+
+    /**
+     * @brief 取消定时器
+     * @param id 定时器标识符
+     * @return 定时器存在并被取消时返回true
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * @brief 推进时间轮
+     * @param now 推进到的时间刻度
+     * @param expired 输出参数，追加所有到期定时器的cookie
+     *
+     * 到期的定时器在返回前即被释放，调用者需要时重新调度。
+     */
+    void advance(Tick now, std::vector<std::uint64_t>& expired);
+
+    /**
+     * @brief 获取下次需要推进的时间刻度
+     * @return 下一个到期或级联的时间刻度，时间轮为空时返回kNoExpiry
+     *
+     * 对高层槽位返回的是级联时刻，是真实到期时间的下界，适合作为唤醒时间。
+     */
+    Tick nextExpiry() const;
+
+    /**
+     * @brief 获取当前时间刻度
+     */
+    Tick currentTick() const { return m_now; }
+
+    /**
+     * @brief 获取活动定时器数量
+     */
+    std::size_t size() const { return m_active; }
+
+private:
+    static constexpr int kLevelBits = 6;                       ///< 每层槽位数的位宽
+    static constexpr int kSlotsPerLevel = 1 << kLevelBits;     ///< 每层槽位数
+    static constexpr int kLevels = 4;                          ///< 层数
+    static constexpr Tick kSlotMask = kSlotsPerLevel - 1;      ///< 槽位掩码
+    static constexpr Tick kMaxDelta = (Tick{1} << (kLevelBits * kLevels)) - 1; ///< 最大可表示跨度
+
+    /**
+     * @brief 定时器节点（双向链表，存放于节点池）
+     */
+    struct Node {
+        Tick expiry{0};                 ///< 真实到期时间
+        std::uint64_t cookie{0};        ///< 用户数据
+        TimerId prev{kInvalidTimer};    ///< 前驱节点
+        TimerId next{kInvalidTimer};    ///< 后继节点
+        std::uint16_t slot{0};          ///< 所在槽位（层号 * 64 + 槽号）
+        bool active{false};             ///< 是否在时间轮中
+    };
+
+    void link(TimerId id);
+    void unlink(TimerId id);
+    void cascade(int level, Tick tick);
+
+private:
+    std::vector<Node> m_nodes;                        ///< 节点池
+    TimerId m_freeHead{kInvalidTimer};                ///< 空闲节点链表头
+    TimerId m_slots[kLevels][kSlotsPerLevel];         ///< 各槽位链表头
+    std::uint64_t m_occupied[kLevels]{};              ///< 各层槽位占用位图
+    Tick m_now;                                       ///< 当前时间刻度
+    std::size_t m_active{0};                          ///< 活动定时器数量
+};
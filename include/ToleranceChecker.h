@@ -14,26 +14,31 @@
 #include <functional>
 #include <unordered_map>
 #include <mutex>
+#include <condition_variable>
 #include <thread>
 #include <atomic>
 #include <chrono>
 #include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <utility>
 
-/**
- * @brief 信号状态枚举
- * 
- * 定义信号在监控过程中的四种可能状态：
- * - UNKNOWN: 初始未知状态（注册后、tc等待期内）
- * - NORMAL:  正常状态（偏差在警告阈值内）
- * - WARNING: 警告状态（偏差超过警告阈值但未超过故障阈值）
- * - FAULT:  故障状态（偏差超过故障阈值）
- */
-enum class SignalState {
-    UNKNOWN = 0,  ///< 初始未知状态，注册后tc等待期内的状态
-    NORMAL,       ///< 正常状态，信号值在容差范围内
-    WARNING,      ///< 警告状态，信号值超出警告阈值
-    FAULT         ///< 故障状态，信号值超出故障阈值
-};
+#include "TimerWheel.h"
+#include "WorkerPool.h"
+#include "CallbackDispatcher.h"
+#include "SignalHotStore.h"
+#include "LatencyHistogram.h"
+#include "BroadcastRing.h"
+#include "RealtimeThread.h"
+#include "SharedSampleSegment.h"
+#include "SampleHistory.h"
+#include "JournalWriter.h"
+#include "BatchCoalescer.h"
+#include "Clock.h"
+#include "SignalState.h"
 
 /**
  * @brief 警告回调函数类型
@@ -54,7 +59,8 @@ using FaultCallback = std::function<void(const std::string& signalId, double val
  * @param signalId 信号标识符
  * @return 当前信号值
  * 
- * 此回调用于实时获取信号值，支持动态数据源
+ * 此回调用于实时获取信号值，支持动态数据源。
+ * 通过pushValue推送数据的信号可以不设置此回调。
  */
 using ValueCallback = std::function<double(const std::string& signalId)>;
 
@@ -65,6 +71,7 @@ using ValueCallback = std::function<double(const std::string& signalId)>;
  * - 目标值和阈值设置
  * - 回调函数配置
  * - 时间控制参数
+ * - 采样周期
  */
 struct SignalConfig {
     double targetValue;              ///< 信号目标值
@@ -72,25 +79,288 @@ struct SignalConfig {
     double faultThreshold;           ///< 故障阈值（与目标值偏差的绝对值）
     WarningCallback warningCallback; ///< 警告回调函数
     FaultCallback faultCallback;     ///< 故障回调函数
-    ValueCallback valueCallback;     ///< 信号值获取回调函数
+    ValueCallback valueCallback;     ///< 信号值获取回调函数（纯推送信号可为空）
     int tcMs;                        ///< tc时间：注册后等待开始监控的时间（毫秒）
     int tsMs;                        ///< ts时间：超出阈值后持续监控时间（毫秒）
+    int samplePeriodMs{0};           ///< 采样周期（毫秒），<=0时使用监控器默认周期
+    std::string groupId;             ///< 所属信号组，非空时由组的批量回调取值（优先于valueCallback）
+    std::shared_ptr<const SharedSampleSegment> sharedSegment; ///< 共享内存样本段，非空时从sharedSlot槽位读取样本（优先于信号组与valueCallback）
+    std::uint32_t sharedSlot{0};     ///< 共享内存样本段中的槽位下标
+    std::uint32_t historyDepth{0};   ///< 保存最近样本的个数（样本历史），0表示不保存
+    double warningExitThreshold{0.0}; ///< 警告退出阈值：进入WARNING或FAULT后偏差需回落到此值以内才恢复正常，<=0表示与warningThreshold相同（无滞回）
+    double faultExitThreshold{0.0};   ///< 故障退出阈值：进入FAULT后偏差需回落到此值以内才离开故障状态，低于warningThreshold时按warningThreshold处理，<=0表示与faultThreshold相同（无滞回）
+};
+
+/**
+ * @brief 批量注册的一项：信号标识符与配置
+ */
+using SignalRegistration = std::pair<std::string, SignalConfig>;
+
+/**
+ * @brief 信号句柄
+ * 
+ * 注册信号时返回的紧凑标识：index为注册表槽位下标，generation为槽位代数。
+ * 信号移除后槽位代数递增，旧句柄自动失效，不会误指向复用该槽位的新信号。
+ * 通过句柄访问信号只需一次数组下标，无需构造字符串或计算哈希。
+ */
+struct SignalHandle {
+    std::uint32_t index{0};       ///< 槽位下标
+    std::uint32_t generation{0};  ///< 槽位代数，0表示无效句柄
+    
+    /**
+     * @brief 句柄是否有效（不代表信号仍然存在）
+     */
+    bool valid() const { return generation != 0; }
+    explicit operator bool() const { return valid(); }
+    
+    /**
+     * @brief 编码为64位整数（C接口使用）
+     */
+    std::uint64_t toValue() const { return (static_cast<std::uint64_t>(generation) << 32) | index; }
+    
+    /**
+     * @brief 从64位整数解码
+     */
+    static SignalHandle fromValue(std::uint64_t value) {
+        return SignalHandle{static_cast<std::uint32_t>(value), static_cast<std::uint32_t>(value >> 32)};
+    }
+    
+    bool operator==(const SignalHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const SignalHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief 信号组批量取值回调函数类型
+ * @param handles 本轮到期信号的句柄数组
+ * @param values 输出数组，按handles的顺序写入各信号的当前值
+ * @param count 信号数量
+ * 
+ * 同一组内到期的信号每轮只调用一次，适用于按设备整块到达的数据。
+ * 在检查线程上调用；抛出异常时丢弃本组本轮的样本。
+ */
+using BatchValueProvider = std::function<void(const SignalHandle* handles, double* values, std::size_t count)>;
+
+/**
+ * @brief 信号组（内部使用）
+ */
+struct SignalGroup {
+    std::string groupId;          ///< 信号组标识符
+    BatchValueProvider provider;  ///< 批量取值回调
+};
+
+/**
+ * @brief 信号级统计（内部使用）
+ * 
+ * 只由检查该信号的线程写入（单一写入者），查询线程可随时读取
+ */
+struct SignalStatsBlock {
+    std::atomic<std::uint64_t> samples{0};            ///< 参与分类的样本数
+    std::atomic<std::uint64_t> warningTransitions{0}; ///< 进入WARNING的次数
+    std::atomic<std::uint64_t> faultTransitions{0};   ///< 进入FAULT的次数
+    std::atomic<std::uint64_t> recoveries{0};         ///< 从WARNING/FAULT恢复到NORMAL的次数
+    std::atomic<std::uint64_t> valueErrors{0};        ///< valueCallback抛出异常的次数
+    CompactLatencyHistogram valueLatency;             ///< valueCallback耗时
 };
 
 /**
  * @brief 信号信息结构（内部使用）
  * 
  * 存储信号的配置信息、当前状态和计时器状态
- * 此结构仅供ToleranceChecker内部使用
+ * 此结构仅供ToleranceChecker内部使用。除state外，其余字段只由监控线程读写。
  */
-struct SignalInfo {
+struct SignalInfo : std::enable_shared_from_this<SignalInfo> {
+    std::string  signalId;                                  ///< 信号标识符
+    SignalHandle handle;                                    ///< 信号句柄
     SignalConfig config;                                    ///< 信号配置
-    SignalState  state{SignalState::UNKNOWN};               ///< 当前状态
+    std::atomic<SignalState> state{SignalState::UNKNOWN};   ///< 当前状态（可被查询线程无锁读取）
     std::chrono::steady_clock::time_point registrationTime; ///< 注册时间点
     std::chrono::steady_clock::time_point warningStartTime; ///< 警告开始时间点
     std::chrono::steady_clock::time_point faultStartTime;   ///< 故障开始时间点
     bool warningTimerActive{false};                         ///< 警告计时器是否激活
     bool faultTimerActive{false};                           ///< 故障计时器是否激活
+    TimerWheel::TimerId timerId{TimerWheel::kInvalidTimer}; ///< 时间轮中的采样定时器
+    TimerWheel::Tick dueTick{0};                            ///< 本次采样的计划时间刻度
+    std::size_t shard{0};                                   ///< 所属分片
+    std::shared_ptr<const SignalGroup> group;               ///< 所属信号组，未分组时为空
+    double warningExitThreshold{0.0};                       ///< 生效的警告退出阈值（注册变更应用时由配置换算）
+    double faultExitThreshold{0.0};                         ///< 生效的故障退出阈值（注册变更应用时由配置换算）
+    bool hysteresis{false};                                 ///< 是否启用滞回（任一退出阈值不同于进入阈值）
+    std::unique_ptr<SignalStatsBlock> statsStorage;         ///< 信号级统计的所有权（监控线程创建，不再释放）
+    std::atomic<SignalStatsBlock*> stats{nullptr};          ///< 信号级统计，未启用统计时为空
+    std::atomic<bool> removed{false};                       ///< 是否已从注册表移除
+    bool applied{false};                                    ///< 注册变更是否已由监控线程应用
+    
+    // 推送样本（顺序锁保护，pushSequence为奇数时表示正在写入，0表示从未推送）
+    std::atomic<std::uint64_t> pushSequence{0};             ///< 推送样本序号
+    std::atomic<double> pushedValue{0.0};                   ///< 最近推送的信号值
+    std::atomic<std::chrono::steady_clock::rep> pushedTime{0}; ///< 最近推送样本的源时间戳
+    std::atomic<bool> pushQueued{false};                    ///< 是否已请求立即评估
+    std::uint64_t consumedSequence{0};                      ///< 已评估的推送样本序号
+    std::uint64_t sharedSequence{0};                        ///< 已评估的共享内存样本序号
+    std::shared_ptr<SampleHistory> history;                 ///< 样本历史（注册时预分配，只由检查线程写入），未启用时为空
+    
+    // 对外发布的状态（顺序锁保护，state、lastValue与stateSince一起更新，只由检查线程写入）
+    std::atomic<std::uint64_t> statusSequence{0};           ///< 发布序号，奇数时表示正在写入
+    std::atomic<double> lastValue{std::numeric_limits<double>::quiet_NaN()}; ///< 最近参与分类的值，尚无样本时为NaN
+    std::atomic<std::chrono::steady_clock::rep> stateSince{0}; ///< 进入当前状态的时间（UNKNOWN时为注册时间）
+};
+
+/**
+ * @brief 推送样本的评估时机
+ * 
+ * - IMMEDIATE: 唤醒监控线程立即评估该信号（默认）
+ * - NEXT_TICK: 仅保存样本，在信号下一次按采样周期检查时评估
+ */
+enum class PushMode {
+    IMMEDIATE = 0,  ///< 立即评估
+    NEXT_TICK       ///< 下一次周期检查时评估
+};
+
+/**
+ * @brief 信号注册表的并发模式
+ * 
+ * - SNAPSHOT: 注册表以不可变快照发布，查询和注册/移除从不等待监控轮次（默认）
+ * - LOCKED:   监控线程在整轮检查期间持有注册表锁，查询需获取同一把锁，
+ *             与早期版本的行为一致，作为兼容回退
+ */
+enum class RegistryMode {
+    SNAPSHOT = 0,  ///< 快照发布（RCU）模式
+    LOCKED         ///< 互斥锁模式
+};
+
+/**
+ * @brief 采样超期时的处理策略
+ * 
+ * 信号的采样时间始终落在以注册时间为起点、采样周期为步长的固定网格上。
+ * 检查耗时过长导致下一个网格点已经过去时：
+ * - SKIP:     跳过已错过的网格点，在下一个未来网格点采样（默认）
+ * - CATCH_UP: 保留错过的网格点，尽快逐个补采，直至追上网格
+ */
+enum class OverrunPolicy {
+    SKIP = 0,   ///< 跳过错过的采样点
+    CATCH_UP    ///< 补采错过的采样点
+};
+
+/**
+ * @brief 分片运行统计
+ * 
+ * 每个分片在每次有信号到期时执行一轮检查，统计其耗时与相对计划采样时间的滞后，
+ * 用于判断大量信号下采样周期是否真正得到满足。
+ */
+struct ShardStats {
+    std::size_t   signalCount{0};     ///< 分配到该分片的信号数量
+    std::uint64_t passes{0};          ///< 已执行的检查轮数
+    std::uint64_t checks{0};          ///< 已执行的信号检查次数
+    std::uint64_t lastPassUs{0};      ///< 最近一轮耗时（微秒）
+    std::uint64_t maxPassUs{0};       ///< 单轮最长耗时（微秒）
+    std::uint64_t totalPassUs{0};     ///< 累计耗时（微秒），除以passes得平均耗时
+    std::uint64_t maxLatenessUs{0};   ///< 一轮完成时相对最早计划采样时间的最大滞后（微秒）
+};
+
+/**
+ * @brief 监控循环运行统计
+ * 
+ * 抖动为监控线程按截止时间唤醒时，实际唤醒时间相对计划时间的偏差；
+ * 因注册、推送等事件提前唤醒的轮次不计入抖动。
+ */
+struct LoopStats {
+    std::uint64_t iterations{0};       ///< 循环轮数
+    std::uint64_t timedWakeups{0};     ///< 按截止时间唤醒的次数
+    std::uint64_t lastJitterUs{0};     ///< 最近一次唤醒抖动（微秒）
+    std::uint64_t maxJitterUs{0};      ///< 最大唤醒抖动（微秒）
+    std::uint64_t totalJitterUs{0};    ///< 累计唤醒抖动（微秒），除以timedWakeups得平均抖动
+    std::uint64_t overruns{0};         ///< 重新调度时下一个采样点已经过去的次数
+    std::uint64_t skippedSamples{0};   ///< SKIP策略下跳过的采样点数量
+    std::uint64_t worstLatenessUs{0};  ///< 信号开始采样时相对计划采样时间的最大滞后（微秒）
+};
+
+/**
+ * @brief 信号状态快照（批量查询的结果项）
+ */
+struct SignalStatus {
+    SignalHandle handle;                                ///< 信号句柄，对应信号不存在时为无效句柄
+    SignalState state{SignalState::UNKNOWN};            ///< 当前状态
+    double lastValue{0.0};                              ///< 最近参与分类的值，尚无样本时为NaN
+    std::chrono::steady_clock::time_point since;        ///< 进入当前状态的时间
+};
+
+/**
+ * @brief 样本历史的内存占用
+ */
+struct HistoryMemoryUsage {
+    std::size_t limitBytes{0};   ///< 内存上限（字节）
+    std::size_t usedBytes{0};    ///< 已注册信号的样本历史占用（字节）
+    std::size_t signalCount{0};  ///< 启用样本历史的信号数量
+};
+
+/**
+ * @brief 状态迁移事件
+ * 
+ * 信号状态每次改变（含tc等待期结束后的首次判定）产生一个事件，序号全局连续
+ */
+struct TransitionEvent {
+    std::uint64_t sequence{0};                          ///< 事件序号
+    SignalHandle handle;                                ///< 信号句柄
+    SignalState oldState{SignalState::UNKNOWN};         ///< 迁移前状态
+    SignalState newState{SignalState::UNKNOWN};         ///< 迁移后状态
+    double value{0.0};                                  ///< 触发迁移的样本值
+    std::chrono::steady_clock::time_point sampleTime;   ///< 样本时间
+    std::chrono::steady_clock::time_point publishTime;  ///< 事件发布时间
+};
+
+/**
+ * @brief 状态迁移批量回调类型
+ * @param events 一个批次的状态迁移事件，只在回调期间有效
+ * @param count 事件数量
+ */
+using TransitionBatchCallback = std::function<void(const TransitionEvent* events, std::size_t count)>;
+
+/**
+ * @brief 状态迁移事件流的读取结果
+ * 
+ * - OK:       读取成功（可能没有新事件）
+ * - OVERRUN:  读取位置落后超过事件流容量或已失效，须调用resyncTransitions()重新同步
+ * - DISABLED: 事件流未启用
+ */
+enum class TransitionReadStatus {
+    OK = 0,    ///< 读取成功
+    OVERRUN,   ///< 读取位置已被覆盖
+    DISABLED   ///< 事件流未启用
+};
+
+/**
+ * @brief 单个信号的统计
+ */
+struct SignalStats {
+    HistogramSummary valueLatency;        ///< valueCallback耗时分布
+    std::uint64_t samples{0};             ///< 参与分类的样本数
+    std::uint64_t warningTransitions{0};  ///< 进入WARNING的次数
+    std::uint64_t faultTransitions{0};    ///< 进入FAULT的次数
+    std::uint64_t recoveries{0};          ///< 恢复到NORMAL的次数
+    std::uint64_t valueErrors{0};         ///< valueCallback抛出异常的次数
+};
+
+/**
+ * @brief 监控器热点路径统计
+ * 
+ * 直方图由统计子系统无锁记录；计数器为所有已启用统计的信号之和，
+ * 以及回调派发与监控循环的对应计数。
+ */
+struct CheckerStats {
+    bool enabled{false};                  ///< 是否正在记录统计
+    HistogramSummary passLatency;         ///< 每轮检查（取样、分类、状态机）耗时
+    HistogramSummary lockHold;            ///< 监控线程持有注册表锁的时长
+    HistogramSummary wakeJitter;          ///< 按截止时间唤醒的抖动
+    HistogramSummary groupFetchLatency;   ///< 信号组批量取值回调耗时
+    std::uint64_t samples{0};             ///< 参与分类的样本数
+    std::uint64_t warningTransitions{0};  ///< 进入WARNING的次数
+    std::uint64_t faultTransitions{0};    ///< 进入FAULT的次数
+    std::uint64_t recoveries{0};          ///< 恢复到NORMAL的次数
+    std::uint64_t valueErrors{0};         ///< valueCallback抛出异常的次数
+    std::uint64_t callbackExceptions{0};  ///< 警告/故障回调抛出异常的次数
+    std::uint64_t overruns{0};            ///< 采样超期次数
 };
 
 /**
@@ -98,6 +368,10 @@ struct SignalInfo {
  * 
  * 使用单例模式的线程安全容差监控系统。
  * 
+ * 信号注册表采用写时复制：注册和移除在写锁内复制当前表并原子发布新快照，
+ * 查询线程和监控线程只读取快照，不会因对方而阻塞。
+ * 快照由引用计数回收，最后一个持有旧快照的读者释放时旧表才被销毁。
+ * 
  * 主要功能：
  * - 多信号注册和管理
  * - 实时监控和状态跟踪
@@ -110,6 +384,13 @@ struct SignalInfo {
  * 3. 检测到偏差超过阈值时开始计时
  * 4. ts时间后触发相应回调并更新状态
  * 
+ * 每个信号按自身的samplePeriodMs挂入分层时间轮，监控线程只唤醒到期的信号，
+ * CPU开销与实际采样率成正比，而与信号总数无关。
+ * 
+ * 可以创建多个相互独立的实例（例如快速控制信号与慢速设施信号各用一个），
+ * 每个实例拥有自己的监控线程、注册表锁和默认采样周期，可分别绑定到不同的CPU核心。
+ * getInstance()返回进程内的默认实例。
+ * 
  * 使用示例：
  * @code
  * auto& checker = ToleranceChecker::getInstance();
@@ -123,6 +404,7 @@ struct SignalInfo {
  * config.faultCallback = onFault;
  * config.tcMs = 1000;  // 1秒等待期
  * config.tsMs = 2000;  // 2秒持续期
+ * config.samplePeriodMs = 10;  // 每10毫秒采样一次
  * 
  * checker.registerSignal("sensor_1", config);
  * // 监控自动开始
@@ -131,25 +413,147 @@ struct SignalInfo {
 class ToleranceChecker {
 public:
     /**
-     * @brief 获取单例实例
-     * @return ToleranceChecker的单例引用
+     * @brief 获取默认实例
+     * @return 默认实例的引用
      * 
-     * 线程安全的单例获取方法，首次调用时创建实例并自动开始监控
+     * 线程安全，首次调用时创建默认实例并自动开始监控
      */
     static ToleranceChecker& getInstance();
     
+    /**
+     * @brief 构造独立的监控器实例
+     * @param defaultSamplePeriodMs 未配置samplePeriodMs的信号使用的默认采样周期（毫秒），<=0时取100
+     * @param clock 计时所用的时钟，为空时使用steady_clock
+     * 
+     * 构造后不会自动开始监控，需调用startMonitoring()。
+     * 注入虚拟时钟时不启动后台线程，由调用者推进时钟并调用runOnce()（或经ReplayEngine）驱动检查
+     */
+    explicit ToleranceChecker(int defaultSamplePeriodMs = 100, std::shared_ptr<Clock> clock = nullptr);
+    
+    /**
+     * @brief 析构函数
+     * 自动停止监控线程
+     */
+    ~ToleranceChecker();
+    
+    // 禁用拷贝和移动操作（回调与监控线程持有实例地址）
+    ToleranceChecker(const ToleranceChecker&) = delete;            ///< 禁用拷贝构造
+    ToleranceChecker& operator=(const ToleranceChecker&) = delete; ///< 禁用拷贝赋值
+    ToleranceChecker(ToleranceChecker&&) = delete;                 ///< 禁用移动构造
+    ToleranceChecker& operator=(ToleranceChecker&&) = delete;      ///< 禁用移动赋值
+    
+    /**
+     * @brief 开始监控
+     * 
+     * 启动后台监控线程，已在运行时不做任何事；使用虚拟时钟时不启动并记录错误日志。
+     * 不可与stopMonitoring()并发调用
+     */
+    void startMonitoring();
+    
+    /**
+     * @brief 获取计时所用的时钟
+     */
+    const std::shared_ptr<Clock>& clock() const { return m_clock; }
+    
+    /**
+     * @brief 在调用线程上按时钟当前时间执行一轮检查
+     * @return 后台监控线程运行中时不执行并返回false
+     * 
+     * 与监控线程的一轮完全相同：应用注册变更与配置，对到期的信号取样分类，
+     * 评估立即推送的样本，发布状态迁移并重新调度。不可与自身并发调用
+     */
+    bool runOnce();
+    
+    /**
+     * @brief 获取下一个信号的计划采样时间
+     * @return 计划采样时间，没有已调度的信号（或后台监控线程运行中）时返回time_point::max()
+     * 
+     * 会先应用待处理的注册变更，使新注册的信号参与调度。与runOnce()配合，
+     * 调用者将虚拟时钟推进到该时间后调用runOnce()即可逐轮重现采样网格
+     */
+    std::chrono::steady_clock::time_point nextDueTime();
+    
+    /**
+     * @brief 启用或停用回放模式
+     * @param enabled true为启用（默认停用）
+     * 
+     * 回放模式下检查不再调用valueCallback与信号组批量回调，也不读取共享内存段：
+     * 配置了这些实时数据源的信号只在收到推送（回放）的样本时评估，
+     * 回放结果不会混入实时读数。纯推送信号的行为不变。ReplayEngine在创建时启用、析构时停用
+     */
+    void setReplayMode(bool enabled) { m_replayMode.store(enabled, std::memory_order_relaxed); }
+    
+    /**
+     * @brief 检查是否处于回放模式
+     */
+    bool replayMode() const { return m_replayMode.load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief 获取默认采样周期（毫秒）
+     */
+    int defaultSamplePeriodMs() const { return m_checkIntervalMs; }
+    
+    /**
+     * @brief 设置监控线程与分片工作线程的CPU亲和性
+     * @param cpus 允许运行的CPU编号，为空时解除绑定
+     * 
+     * 由监控线程在下一轮开始前应用（未运行时在启动后应用）。
+     * 此后由监控线程创建的分片工作线程与回调派发线程继承该设置。仅Linux平台生效
+     */
+    void setCpuAffinity(const std::vector<unsigned>& cpus);
+    
+    /**
+     * @brief 配置监控线程的实时运行环境
+     * @param config 调度策略与优先级、CPU亲和性、内存锁定与栈预取
+     * 
+     * 由监控线程在下一轮开始前应用到自身（未运行时在启动后应用），调度策略与亲和性同时应用到
+     * 已有的分片工作线程，此后由监控线程创建的工作线程与回调派发线程继承该设置。
+     * 应用结果写入日志，并可通过getRealtimeReport()查询。仅Linux平台生效
+     */
+    void configureRealtime(const RealtimeConfig& config);
+    
+    /**
+     * @brief 获取实时配置的实际生效结果
+     * @return 最近一次应用的结果，尚未应用时applied为false
+     */
+    RealtimeReport getRealtimeReport() const;
+    
     /**
      * @brief 注册信号
      * @param signalId 信号唯一标识符
      * @param config 信号配置结构
-     * @return 成功返回true，失败返回false
+     * @return 成功返回有效句柄，失败返回无效句柄（可直接用于条件判断）
      * 
      * 注册新的监控信号。注册后信号进入UNKNOWN状态，
      * tc时间后开始正式监控。
      * 
      * @note 相同signalId的信号不能重复注册
      */
-    bool registerSignal(const std::string& signalId, const SignalConfig& config);
+    SignalHandle registerSignal(const std::string& signalId, const SignalConfig& config);
+    
+    /**
+     * @brief 批量注册信号
+     * @param signals 信号标识符与配置列表
+     * @return 与signals一一对应的句柄，注册失败（ID重复或信号组未注册）的项为无效句柄
+     * 
+     * 信号信息在锁外并行构造，注册表只复制并发布一次，
+     * 整批信号同时对监控线程和查询线程可见。适用于启动时加载大规模配置。
+     */
+    std::vector<SignalHandle> registerSignals(const std::vector<SignalRegistration>& signals);
+    
+    /**
+     * @brief 按ID查找信号句柄
+     * @param signalId 信号标识符
+     * @return 信号句柄，未找到时返回无效句柄
+     * 
+     * 字符串查找仅用于发现信号，之后的查询、推送和移除应使用句柄
+     */
+    SignalHandle findSignal(const std::string& signalId) const;
+    
+    /**
+     * @brief 检查句柄指向的信号是否仍在注册表中
+     */
+    bool isRegistered(SignalHandle handle) const;
     
     /**
      * @brief 停止监控
@@ -173,63 +577,696 @@ public:
      */
     void removeSignal(const std::string& signalId);
     
+    /**
+     * @brief 按句柄移除信号
+     * @param handle 信号句柄
+     * @return 句柄指向的信号存在并被移除时返回true
+     */
+    bool removeSignal(SignalHandle handle);
+    
+    /**
+     * @brief 按句柄批量移除信号
+     * @param handles 信号句柄列表
+     * @return 实际移除的信号数量（失效句柄被忽略）
+     * 
+     * 注册表只复制并发布一次
+     */
+    std::size_t removeSignals(const std::vector<SignalHandle>& handles);
+    
+    /**
+     * @brief 按ID批量移除信号
+     * @param signalIds 信号标识符列表
+     * @return 实际移除的信号数量（未注册的ID被忽略）
+     */
+    std::size_t removeSignals(const std::vector<std::string>& signalIds);
+    
+    /**
+     * @brief 注册信号组
+     * @param groupId 信号组标识符
+     * @param provider 批量取值回调
+     * @return 注册成功返回true，组已存在或回调为空时返回false
+     * 
+     * 配置了groupId的信号须在组注册之后注册。同组信号被分配到同一分片，
+     * 每轮检查对组内到期的信号只调用一次provider。
+     */
+    bool registerSignalGroup(const std::string& groupId, BatchValueProvider provider);
+    
+    /**
+     * @brief 移除信号组
+     * @param groupId 信号组标识符
+     * @return 组存在并被移除时返回true
+     * 
+     * 已注册的组内信号仍保留对回调的引用，直至信号被移除
+     */
+    bool removeSignalGroup(const std::string& groupId);
+    
+    /**
+     * @brief 检查信号组是否已注册
+     */
+    bool isSignalGroupRegistered(const std::string& groupId) const;
+    
     /**
      * @brief 获取信号当前状态
      * @param signalId 信号标识符
      * @return 信号当前状态，未找到信号时返回NORMAL
      */
     SignalState getSignalState(const std::string& signalId) const;
-
-private:
+    
     /**
-     * @brief 私有构造函数（单例模式）
+     * @brief 按句柄获取信号当前状态
+     * @param handle 信号句柄
+     * @return 信号当前状态，句柄失效时返回NORMAL
      */
-    ToleranceChecker() = default;
+    SignalState getSignalState(SignalHandle handle) const;
     
     /**
-     * @brief 析构函数
-     * 自动停止监控线程
+     * @brief 批量读取所有已注册信号的状态
+     * @param out 调用者提供的输出数组
+     * @param capacity 输出数组容量
+     * @return 已注册信号的总数，大于capacity时只写入前capacity项
+     * 
+     * 只读取一次注册表快照，按槽位顺序输出，不获取注册表锁（LOCKED模式除外）。
+     * 每项的状态、最近值与进入时间来自同一次检查。
      */
-    ~ToleranceChecker();
+    std::size_t getSignalStates(SignalStatus* out, std::size_t capacity) const;
     
-    // 禁用拷贝和移动操作（单例模式）
-    ToleranceChecker(const ToleranceChecker&) = delete;            ///< 禁用拷贝构造
-    ToleranceChecker& operator=(const ToleranceChecker&) = delete; ///< 禁用拷贝赋值
-    ToleranceChecker(ToleranceChecker&&) = delete;                 ///< 禁用移动构造
-    ToleranceChecker& operator=(ToleranceChecker&&) = delete;      ///< 禁用移动赋值
-
     /**
-     * @brief 开始监控（内部方法）
+     * @brief 按句柄批量读取信号状态
+     * @param handles 信号句柄数组
+     * @param count 句柄数量
+     * @param out 调用者提供的输出数组，与handles一一对应
+     * @return 有效句柄的数量，失效句柄对应项的handle为无效句柄
+     */
+    std::size_t getSignalStates(const SignalHandle* handles, std::size_t count, SignalStatus* out) const;
+    
+    /**
+     * @brief 获取信号样本历史的零拷贝视图
+     * @param handle 信号句柄
+     * @return 从旧到新的最近样本，句柄失效或信号未启用样本历史时为空视图
      * 
-     * 启动后台监控线程，开始周期性检查所有注册的信号
+     * 在故障/警告回调中调用时包含触发回调的样本；回调由派发线程执行时其后还可能有更新的样本。
+     * 检查线程之外使用视图时，读完后应检查SampleHistoryView::intact()
      */
-    void startMonitoring();
+    SampleHistoryView getSampleHistory(SignalHandle handle) const;
+    
+    /**
+     * @brief 按ID获取信号样本历史的零拷贝视图
+     */
+    SampleHistoryView getSampleHistory(const std::string& signalId) const;
+    
+    /**
+     * @brief 导出信号的样本历史
+     * @param handle 信号句柄
+     * @param out 调用者提供的输出数组
+     * @param capacity 输出数组容量，小于已保存的样本数时只导出最新的部分
+     * @return 导出的样本数（从旧到新），句柄失效或未启用样本历史时为0
+     */
+    std::size_t exportSampleHistory(SignalHandle handle, HistorySample* out, std::size_t capacity) const;
+    
+    /**
+     * @brief 设置样本历史的总内存上限
+     * @param bytes 上限（字节），默认64MB
+     * 
+     * 只影响之后的注册：超出上限的信号注册失败。已注册信号的历史不受影响
+     */
+    void setHistoryMemoryLimit(std::size_t bytes);
+    
+    /**
+     * @brief 获取样本历史的内存占用
+     */
+    HistoryMemoryUsage getHistoryMemoryUsage() const;
+    
+    /**
+     * @brief 推送信号样本
+     * @param signalId 信号标识符
+     * @param value 信号值
+     * @param timestamp 样本的源时间戳，tc/ts计时以此为准；默认（零值）取监控器时钟的当前时间
+     * @param mode 评估时机，默认立即评估
+     * @return 信号存在返回true，否则返回false
+     * 
+     * 适用于数据已在手中的数据源（如现场总线网关），无需再经由valueCallback轮询。
+     * 新推送的样本优先于valueCallback；同一周期内多次推送只评估最新的一个。
+     * 纯推送信号在没有新样本时，周期检查沿用最近一次推送的值推进计时。
+     * 可从任意线程调用，不会阻塞在监控轮次上（LOCKED模式除外）。
+     */
+    bool pushValue(const std::string& signalId, double value,
+                   std::chrono::steady_clock::time_point timestamp = {},
+                   PushMode mode = PushMode::IMMEDIATE);
+    
+    /**
+     * @brief 按句柄推送信号样本
+     * @return 句柄指向的信号存在返回true，否则返回false
+     * 
+     * 语义同pushValue(const std::string&, ...)
+     */
+    bool pushValue(SignalHandle handle, double value,
+                   std::chrono::steady_clock::time_point timestamp = {},
+                   PushMode mode = PushMode::IMMEDIATE);
+    
+    /**
+     * @brief 配置分片监控模式
+     * @param workerCount 工作线程数量，0表示在监控线程上顺序检查（默认）
+     * @param shardCount 分片数量，0表示自动选择（工作线程数的4倍）
+     * 
+     * 信号按ID哈希固定分配到分片，每轮到期的信号按分片打包为任务，
+     * 由工作窃取线程池并行执行，回调较慢的分片不会拖慢其他分片。
+     * 
+     * @note 多工作线程时，不同信号的回调可能在不同线程上并发执行
+     */
+    void configureSharding(unsigned workerCount, unsigned shardCount = 0);
+    
+    /**
+     * @brief 获取各分片的运行统计
+     * @return 按分片序号排列的统计信息
+     */
+    std::vector<ShardStats> getShardStats() const;
+    
+    /**
+     * @brief 设置注册表并发模式
+     * @param mode 并发模式，默认为RegistryMode::SNAPSHOT
+     * 
+     * 从下一轮检查开始生效
+     */
+    void setRegistryMode(RegistryMode mode);
+    
+    /**
+     * @brief 获取注册表并发模式
+     */
+    RegistryMode getRegistryMode() const;
+    
+    /**
+     * @brief 配置异步回调派发
+     * @param threadCount 派发线程数量，0表示在检查线程上直接调用回调（默认）
+     * @param queueCapacity 每个派发线程的队列容量
+     * @param policy 队列满时的处理策略
+     * 
+     * 启用后，警告/故障回调由专用派发线程执行，检查循环只负责入队。
+     * 同一信号的回调始终按发生顺序执行。从下一轮检查开始生效，
+     * 旧队列中的事件会在切换前全部投递。
+     */
+    void configureDispatch(unsigned threadCount, std::size_t queueCapacity = 1024,
+                           OverflowPolicy policy = OverflowPolicy::DROP);
+    
+    /**
+     * @brief 获取回调派发统计
+     */
+    DispatchStats getDispatchStats() const;
+    
+    /**
+     * @brief 设置采样超期时的处理策略
+     * @param policy 处理策略，默认为OverrunPolicy::SKIP
+     * 
+     * 从下一次重新调度开始生效
+     */
+    void setOverrunPolicy(OverrunPolicy policy);
+    
+    /**
+     * @brief 获取采样超期时的处理策略
+     */
+    OverrunPolicy getOverrunPolicy() const;
+    
+    /**
+     * @brief 获取监控循环的抖动、超期与滞后统计
+     */
+    LoopStats getLoopStats() const;
+    
+    /**
+     * @brief 启用或停用热点路径统计
+     * @param enabled true为启用（默认停用）
+     * 
+     * 首次启用时校准计时源（阻塞约20毫秒），并在下一轮检查前为已注册信号分配信号级统计。
+     * 启用后每个样本的额外开销约为两次时间戳读取与几次relaxed原子写入。
+     */
+    void enableStats(bool enabled);
+    
+    /**
+     * @brief 检查是否正在记录统计
+     */
+    bool statsEnabled() const;
+    
+    /**
+     * @brief 获取热点路径统计
+     */
+    CheckerStats getStats() const;
+    
+    /**
+     * @brief 获取单个信号的统计
+     * @param handle 信号句柄
+     * @param stats 输出参数，存储信号统计
+     * @return 句柄有效且信号已分配统计时返回true
+     */
+    bool getSignalStats(SignalHandle handle, SignalStats& stats) const;
+    
+    /**
+     * @brief 启用或停用状态迁移事件流
+     * @param capacity 事件流容量（向上取整为2的幂），0表示停用
+     * 
+     * 事件由检查线程暂存，监控线程在每轮结束时统一发布到单写者广播环，
+     * 检查线程从不等待消费者。由监控线程在下一轮开始前应用；
+     * 更换容量后新事件流的序号接续旧事件流，未读完旧事件的消费者会读到OVERRUN。
+     */
+    void enableTransitionStream(std::size_t capacity);
+    
+    /**
+     * @brief 订阅状态迁移事件流
+     * @return 新消费者的读取位置（下一个将发布的事件序号），事件流未启用时返回0
+     */
+    std::uint64_t subscribeTransitions() const;
+    
+    /**
+     * @brief 批量读取状态迁移事件
+     * @param cursor 输入输出参数，读取位置，返回时指向下一个未读事件
+     * @param out 调用者提供的输出数组
+     * @param capacity 输出数组容量
+     * @param count 输出参数，实际读出的事件数量
+     * @return 读取结果；OVERRUN时本次已读出的事件仍然有效，之后的事件已丢失
+     * 
+     * 各消费者持有自己的读取位置，互不影响，可由任意线程无锁调用
+     */
+    TransitionReadStatus readTransitions(std::uint64_t& cursor, TransitionEvent* out, std::size_t capacity,
+                                         std::size_t& count) const;
+    
+    /**
+     * @brief 溢出后重新同步：读取状态快照并返回新的读取位置
+     * @param out 调用者提供的状态输出数组
+     * @param capacity 输出数组容量
+     * @param total 输出参数，已注册信号的总数
+     * @return 新的读取位置，事件流未启用时返回0
+     * 
+     * 读取位置之前的所有事件均已反映在快照中；快照也可能已包含其后的部分事件，
+     * 消费者按事件的newState覆盖即可收敛
+     */
+    std::uint64_t resyncTransitions(SignalStatus* out, std::size_t capacity, std::size_t& total) const;
+    
+    /**
+     * @brief 设置状态迁移批量回调
+     * @param callback 批量回调，为空表示停用
+     * @param config 交付配置
+     * 
+     * 同一轮检查产生的全部迁移（或合并窗口内的多轮迁移）合并为一个连续数组，
+     * 由专用交付线程整批调用回调，单批不超过maxBatch个事件，批次中最早的事件最多等待maxLatencyMs。
+     * 与逐信号的警告/故障回调相互独立，二者可同时使用。事件流未启用时事件的sequence为0。
+     * 旧回调在调用线程上交付完剩余的事件并停止其交付线程，返回后旧回调不会再被调用，
+     * 其捕获的资源可以释放。批量回调内可以查询交付统计，但不能设置批量回调
+     * @return 成功返回true，在批量回调内调用时返回false（不做切换）
+     */
+    bool setTransitionBatchSink(TransitionBatchCallback callback, const BatchConfig& config = BatchConfig{});
+    
+    /**
+     * @brief 获取状态迁移批量回调的交付统计
+     */
+    BatchStats getTransitionBatchStats() const;
+    
+    /**
+     * @brief 启用事件日志
+     * @param config 日志配置
+     * @return 成功创建第一个段文件返回true，失败返回false（errno指示原因）
+     * 
+     * 状态迁移（以及可选的原始样本）由监控线程在每轮检查结束后经内存映射写入段文件，
+     * 检查线程不做任何文件I/O。信号句柄与ID在每个段文件开头及注册时写入。
+     * 由监控线程在下一轮开始前切换；已启用时替换为新的日志。可用JournalReader离线读取
+     */
+    bool enableJournal(const JournalConfig& config);
+    
+    /**
+     * @brief 停用事件日志
+     * 
+     * 由监控线程在下一轮开始前关闭当前段文件
+     */
+    void disableJournal();
+    
+    /**
+     * @brief 获取事件日志统计
+     */
+    JournalStats getJournalStats() const;
+
+private:
+    /**
+     * @brief 信号注册表，发布后不再修改
+     */
+    struct SignalTable {
+        std::unordered_map<std::string, std::shared_ptr<SignalInfo>> byId; ///< 按ID索引（用于发现）
+        std::vector<std::shared_ptr<SignalInfo>> slots;                   ///< 按句柄槽位索引
+
+        /**
+         * @brief 按句柄查找信号，句柄失效时返回空
+         */
+        std::shared_ptr<SignalInfo> find(SignalHandle handle) const;
+    };
+
+    /**
+     * @brief 待监控线程处理的注册表变更
+     */
+    struct RegistryChange {
+        std::shared_ptr<SignalInfo> signal;  ///< 变更的信号
+        bool added;                          ///< true为注册，false为移除
+    };
+
+    /**
+     * @brief 一个信号组本轮的批量取值请求
+     */
+    struct GroupBatch {
+        const SignalGroup* group{nullptr};  ///< 信号组
+        std::vector<SignalInfo*> signals;   ///< 本轮到期的组内信号
+        std::vector<SignalHandle> handles;  ///< 对应的信号句柄
+        std::vector<double> values;         ///< 批量取得的值
+    };
 
+    /**
+     * @brief 样本获取结果
+     */
+    enum class SampleStatus {
+        NONE,   ///< 本轮没有样本
+        READY,  ///< 已取得样本
+        GROUP   ///< 需要通过信号组批量取值
+    };
+
+    /**
+     * @brief 分片检查的暂存区，按分片复用以避免每轮分配
+     */
+    struct ShardScratch {
+        std::vector<SignalInfo*> signals;                                ///< 本轮取得样本的信号
+        std::vector<std::uint32_t> slots;                                ///< 对应的热存储槽位
+        std::vector<std::chrono::steady_clock::time_point> sampleTimes;  ///< 对应的样本时间
+        std::vector<std::uint8_t> bands;                                 ///< 批量分类结果
+        std::vector<GroupBatch> groups;                                  ///< 各信号组的取值请求（前groupCount项有效）
+        std::size_t groupCount{0};                                       ///< 本轮涉及的信号组数量
+        std::unordered_map<const SignalGroup*, std::size_t> groupIndex;  ///< 信号组到请求下标的映射
+        std::vector<TransitionEvent> transitions;                        ///< 本轮待发布的状态迁移事件
+        std::vector<HistorySample> journalSamples;                       ///< 本轮待写入事件日志的原始样本
+        std::vector<SignalHandle> journalHandles;                        ///< journalSamples对应的信号句柄
+    };
+    
     /**
      * @brief 监控主循环（内部方法）
      * 
-     * 后台线程执行的主循环，周期性调用checkSignal检查所有信号
+     * 后台线程执行的主循环，推进时间轮并只对到期的信号取样、批量分类，
+     * 随后休眠至下一个到期时间或被注册操作唤醒
      */
     void monitoringLoop();
+
+    /**
+     * @brief 执行一轮检查（内部方法）
+     * @return 本轮最早到期信号的滞后
+     * 
+     * 在监控线程（或runOnce()的调用线程）上推进时间轮、检查到期与推送的信号并重新调度
+     */
+    std::chrono::steady_clock::duration runPass();
+
+    /**
+     * @brief 累计一轮的循环统计（内部方法）
+     */
+    void recordLoopStats(std::chrono::steady_clock::duration passLateness, bool timedWakeup,
+                         std::chrono::steady_clock::duration wakeJitter);
+
+    /**
+     * @brief 处理积压的注册表变更、分片与派发配置（内部方法）
+     * 
+     * 只在监控线程上调用：新注册的信号挂入时间轮，已移除的信号移出时间轮
+     */
+    void applyPendingChanges();
+
+    /**
+     * @brief 将新注册信号的首次采样挂入时间轮（内部方法）
+     * @param signalInfo 信号信息
+     * @param dueTick 计划采样的时间刻度
+     * 
+     * 只在监控线程上调用
+     */
+    void scheduleSignal(SignalInfo& signalInfo, TimerWheel::Tick dueTick);
+
+    /**
+     * @brief 按采样网格调度信号的下一次采样（内部方法）
+     * @param signalInfo 本轮已检查的信号
+     * 
+     * 下一个网格点已经过去时按超期策略处理。只在监控线程上调用
+     */
+    void rescheduleSignal(SignalInfo& signalInfo);
+
+    /**
+     * @brief 在当前快照中查找信号（内部方法）
+     * 
+     * LOCKED模式下获取注册表锁
+     */
+    std::shared_ptr<SignalInfo> lookupSignal(const std::string& signalId) const;
+    std::shared_ptr<SignalInfo> lookupSignal(SignalHandle handle) const;
+
+    /**
+     * @brief 取得当前注册表快照（内部方法）
+     * 
+     * LOCKED模式下在持有注册表锁时读取
+     */
+    std::shared_ptr<const SignalTable> loadSnapshot() const;
+
+    /**
+     * @brief 以顺序锁一致地读取信号的对外状态（内部方法）
+     */
+    static void readStatus(const SignalInfo& signalInfo, SignalStatus& status);
+
+    /**
+     * @brief 检查信号能否注册并解析其所属信号组（内部方法）
+     * @param table 待写入的注册表
+     * @param group 输出参数，信号所属的组
+     * @return ID未注册且信号组存在时返回true
+     * 
+     * 调用者必须持有m_signalsMutex
+     */
+    bool validateRegistrationLocked(const SignalTable& table, const std::string& signalId,
+                                    const SignalConfig& config, std::shared_ptr<const SignalGroup>& group) const;
+
+    /**
+     * @brief 为信号分配槽位并写入待发布的注册表（内部方法）
+     * @return 分配的句柄
+     * 
+     * 同时登记注册变更，调用者负责发布快照并唤醒监控线程。调用者必须持有m_signalsMutex
+     */
+    SignalHandle insertSignalLocked(SignalTable& next, std::shared_ptr<SignalInfo> signalInfo);
+
+    /**
+     * @brief 从待发布的注册表中移除信号并使其句柄失效（内部方法）
+     * 
+     * 同时登记移除变更，调用者负责发布快照并唤醒监控线程。调用者必须持有m_signalsMutex
+     */
+    void retireSignalLocked(SignalTable& next, const std::shared_ptr<SignalInfo>& signalInfo);
+
+    /**
+     * @brief 发布移除了指定信号的新快照（内部方法）
+     * 
+     * 调用者必须持有m_signalsMutex
+     */
+    void removeSignalLocked(const SignalTable& current, const std::shared_ptr<SignalInfo>& signalInfo);
+
+    /**
+     * @brief 复制一次注册表，执行一批移除后发布（内部方法）
+     * @param retire 以新注册表为参数逐项移除信号，返回移除数量
+     */
+    template <typename Retire>
+    std::size_t removeSignalsBatch(Retire&& retire);
+
+    /**
+     * @brief 写入推送样本并按需请求立即评估（内部方法）
+     */
+    void pushSample(std::shared_ptr<SignalInfo> signalInfo, double value,
+                    std::chrono::steady_clock::time_point timestamp, PushMode mode);
+
+    /**
+     * @brief 在监控线程上立即评估收到推送样本的信号（内部方法）
+     * @return 有信号的注册变更尚未应用、其样本留到下一轮评估时返回true
+     */
+    bool evaluatePushedSignals();
+
+    /**
+     * @brief 读取信号最近一次推送的样本（内部方法）
+     * @return 曾经推送过样本时返回true
+     */
+    static bool readPushedSample(const SignalInfo& signalInfo, double& value,
+                                 std::chrono::steady_clock::time_point& timestamp,
+                                 std::uint64_t& sequence);
+
+    /**
+     * @brief 执行所有非空分片的本轮检查（内部方法）
+     * 
+     * 有线程池时并行执行，否则在监控线程上顺序执行
+     */
+    void runShards();
+
+    /**
+     * @brief 检查单个分片中本轮到期的信号并记录统计（内部方法）
+     * @param shard 分片序号
+     */
+    void runShard(std::size_t shard);
+
+    /**
+     * @brief 计算信号所属分片，同组信号落在同一分片
+     */
+    std::size_t shardOf(const SignalInfo& signalInfo) const;
+
+    /**
+     * @brief 获取信号的有效采样周期（毫秒）
+     */
+    int samplePeriodOf(const SignalInfo& signalInfo) const;
+
+    /**
+     * @brief 将时间点转换为时间轮刻度
+     */
+    TimerWheel::Tick toTick(std::chrono::steady_clock::time_point timePoint) const;
     
     /**
      * @brief 检查单个信号（内部方法）
-     * @param signalId 信号标识符
      * @param signalInfo 信号信息引用
      * 
      * 检查单个信号的状态，包括：
+     * - 取推送的新样本或通过valueCallback获取当前值
      * - tc等待期检查
-     * - 通过valueCallback获取当前值
      * - 计算偏差并判断状态
-     * - 管理计时器和触发回调
+     * - 管理计时器并派发回调
+     * 
+     * 用于推送样本的立即评估；周期检查由runShard批量分类后调用updateSignalState
      */
-    void checkSignal(const std::string& signalId, SignalInfo& signalInfo);
+    void checkSignal(SignalInfo& signalInfo);
+
+    /**
+     * @brief 获取信号本次检查的样本（内部方法）
+     * @param signalInfo 信号信息
+     * @param value 输出参数，样本值
+     * @param now 输入当前时间；使用推送样本时输出样本的源时间戳
+     * @return 样本获取结果；分组信号没有新推送样本时返回GROUP，由调用者批量取值
+     */
+    SampleStatus acquireSample(SignalInfo& signalInfo, double& value,
+                               std::chrono::steady_clock::time_point& now);
+
+    /**
+     * @brief 检查信号是否已过tc等待期（内部方法）
+     * @param signalInfo 信号信息
+     * @param now 样本时间
+     */
+    bool settled(const SignalInfo& signalInfo, std::chrono::steady_clock::time_point now) const;
+
+    /**
+     * @brief 对分片中本轮涉及的信号组各调用一次批量取值回调（内部方法）
+     * @param scratch 分片暂存区，取得的样本追加到其中
+     * @param now 样本时间
+     */
+    void fetchGroupSamples(ShardScratch& scratch, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief 按偏差分类结果推进信号状态机（内部方法）
+     * @param signalInfo 信号信息
+     * @param band 分类结果（SignalState取值：NORMAL/WARNING/FAULT）
+     * @param value 样本值，用于派发回调
+     * @param now 样本时间
+     * 
+     * 管理ts计时器，状态迁移时派发回调并同步热存储中的状态镜像
+     */
+    void updateSignalState(SignalInfo& signalInfo, std::uint8_t band, double value,
+                           std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief 为信号分配信号级统计（内部方法）
+     * 
+     * 只在监控线程上调用，已分配时不做任何事
+     */
+    void allocateSignalStats(SignalInfo& signalInfo);
+
+    /**
+     * @brief 将各分片暂存的状态迁移事件发布到事件流（内部方法）
+     * 
+     * 只在监控线程上、分片任务全部结束后调用
+     */
+    void publishTransitions();
+
+    /**
+     * @brief 当前批次必须移交给批量回调的时间（内部方法），未启用或批次为空时返回time_point::max()
+     */
+    std::chrono::steady_clock::time_point batchSinkDeadline() const;
+
+    /**
+     * @brief 取得当前批量回调的引用（内部方法），须以releaseBatchSink()放下
+     */
+    std::shared_ptr<BatchCoalescer<TransitionEvent>> acquireBatchSink();
+
+    /**
+     * @brief 放下acquireBatchSink()取得的引用并通知等待换下旧合并器的设置线程（内部方法）
+     */
+    void releaseBatchSink(std::shared_ptr<BatchCoalescer<TransitionEvent>>& sink);
+    
+    /**
+     * @brief 将所有已注册信号的句柄与ID写入事件日志（内部方法）
+     */
+    void journalSignals(const SignalTable& table);
 
 private:
-    mutable std::mutex m_signalsMutex;                    ///< 信号集合的互斥锁
-    std::unordered_map<std::string, SignalInfo> m_signals; ///< 信号信息映射表
+    mutable std::mutex m_signalsMutex;                    ///< 注册表写锁，同时保护变更队列
+    std::shared_ptr<const SignalTable> m_snapshot{std::make_shared<SignalTable>()}; ///< 当前注册表快照（原子读写）
+    std::vector<RegistryChange> m_pendingChanges;         ///< 待监控线程处理的变更
+    std::vector<std::uint32_t> m_slotGenerations;         ///< 各槽位当前代数（受m_signalsMutex保护）
+    std::vector<std::uint32_t> m_freeSlots;               ///< 可复用的槽位（受m_signalsMutex保护）
+    std::unordered_map<std::string, std::shared_ptr<const SignalGroup>> m_groups; ///< 已注册的信号组（受m_signalsMutex保护）
+    std::size_t m_historyLimitBytes{64u << 20};           ///< 样本历史内存上限（受m_signalsMutex保护）
+    std::size_t m_historyBytes{0};                        ///< 样本历史已占用内存（受m_signalsMutex保护）
+    std::size_t m_historySignals{0};                      ///< 启用样本历史的信号数（受m_signalsMutex保护）
+    std::atomic<RegistryMode> m_registryMode{RegistryMode::SNAPSHOT}; ///< 注册表并发模式
+    
+    TimerWheel m_timerWheel;                              ///< 采样调度时间轮（仅监控线程访问）
+    std::vector<std::uint64_t> m_expiredSignals;          ///< 本轮到期信号缓冲区
+    std::condition_variable m_wakeCondition;              ///< 唤醒监控线程的条件变量
+    const std::shared_ptr<Clock> m_clock;                 ///< 计时所用的时钟
+    const std::chrono::steady_clock::time_point m_epoch;  ///< 时间轮零点（构造时的时钟时间）
+    
+    bool m_shardingPending{false};                        ///< 是否有待应用的分片配置
+    unsigned m_pendingWorkerCount{0};                     ///< 待应用的工作线程数量
+    std::size_t m_pendingShardCount{1};                   ///< 待应用的分片数量
+    bool m_dispatchPending{false};                        ///< 是否有待应用的派发配置
+    unsigned m_pendingDispatchThreads{0};                 ///< 待应用的派发线程数量
+    std::size_t m_pendingDispatchCapacity{0};             ///< 待应用的派发队列容量
+    OverflowPolicy m_pendingDispatchPolicy{OverflowPolicy::DROP}; ///< 待应用的溢出策略
+    bool m_pushWakeRequested{false};                      ///< 是否有待立即评估的推送样本
+    
+    std::mutex m_pushMutex;                               ///< 推送评估队列的互斥锁
+    std::vector<std::shared_ptr<SignalInfo>> m_pushedSignals; ///< 待立即评估的信号
+    std::vector<std::shared_ptr<SignalInfo>> m_pushedBatch;   ///< 本轮取出的待评估信号
+    std::unique_ptr<WorkerPool> m_workerPool;             ///< 分片工作线程池，为空时顺序检查
+    std::size_t m_shardCount{1};                          ///< 分片数量
+    std::vector<std::vector<SignalInfo*>> m_shardBuckets{1}; ///< 本轮各分片到期的信号
+    std::vector<WorkerPool::Task> m_shardTasks;           ///< 本轮分片任务
+    mutable std::mutex m_statsMutex;                      ///< 分片统计的互斥锁
+    std::vector<ShardStats> m_shardStats{1};              ///< 各分片运行统计
+    LoopStats m_loopStats;                                ///< 监控循环统计（受m_statsMutex保护）
+    std::uint64_t m_passOverruns{0};                      ///< 本轮超期次数（仅监控线程访问）
+    std::uint64_t m_passSkippedSamples{0};                ///< 本轮跳过的采样点（仅监控线程访问）
+    std::atomic<OverrunPolicy> m_overrunPolicy{OverrunPolicy::SKIP}; ///< 采样超期处理策略
+    
+    std::atomic<bool> m_statsEnabled{false};              ///< 是否记录热点路径统计
+    bool m_statsAllocationPending{false};                 ///< 是否需要为已注册信号分配统计（受m_signalsMutex保护）
+    LatencyHistogram m_passLatency;                       ///< 每轮检查耗时（仅监控线程写入）
+    LatencyHistogram m_lockHold;                          ///< 注册表锁持有时长（仅监控线程写入）
+    LatencyHistogram m_wakeJitter;                        ///< 唤醒抖动（仅监控线程写入）
+    LatencyHistogram m_groupFetchLatency;                 ///< 信号组取值耗时（分片线程并发写入）
+    std::vector<ShardScratch> m_shardScratch{1};          ///< 各分片的检查暂存区
+    std::shared_ptr<BroadcastRing<TransitionEvent>> m_transitionRing; ///< 状态迁移事件流（原子读写，为空表示未启用）
+    BroadcastRing<TransitionEvent>* m_transitionWriter{nullptr}; ///< 当前事件流的写入端（仅监控线程及分片任务访问）
+    std::uint64_t m_nextTransitionSequence{1};            ///< 事件流停用期间保留的下一个序号（仅监控线程访问）
+    bool m_transitionPending{false};                      ///< 是否有待应用的事件流配置（受m_signalsMutex保护）
+    std::size_t m_pendingTransitionCapacity{0};           ///< 待应用的事件流容量（受m_signalsMutex保护）
+    std::shared_ptr<JournalWriter> m_journal;             ///< 事件日志（原子读写，为空表示未启用）
+    JournalWriter* m_journalWriter{nullptr};              ///< 当前事件日志的写入端（仅监控线程及分片任务访问）
+    bool m_journalSamples{false};                         ///< 是否记录原始样本（仅监控线程及分片任务访问）
+    bool m_journalPending{false};                         ///< 是否有待应用的事件日志切换（受m_signalsMutex保护）
+    std::shared_ptr<JournalWriter> m_pendingJournal;      ///< 待切换的事件日志，为空表示停用（受m_signalsMutex保护）
+    mutable std::mutex m_batchSinkMutex;                  ///< 保护批量回调的切换与引用计数（不在持锁时追加或移交批次）
+    std::condition_variable m_batchSinkReleased;          ///< 监控线程放下批量回调引用时通知设置线程
+    std::shared_ptr<BatchCoalescer<TransitionEvent>> m_batchSink; ///< 状态迁移批量回调，为空表示未启用（受m_batchSinkMutex保护）
+    std::atomic<bool> m_batchSinkEnabled{false};          ///< 批量回调是否启用（分片任务据此收集迁移）
+    SignalHotStore m_hotStore;                            ///< 阈值与最近值的SoA热存储（仅监控线程及分片任务访问）
+    CallbackDispatcher m_dispatcher;                      ///< 警告/故障回调派发器
     
     std::atomic<bool> m_isMonitoring{false};              ///< 监控状态标志
+    std::atomic<bool> m_replayMode{false};                ///< 回放模式：只评估推送的样本，不读取实时数据源
     std::thread m_monitoringThread;                       ///< 后台监控线程
-    int m_checkIntervalMs{100};                           ///< 检查间隔（毫秒）
+    const int m_checkIntervalMs;                          ///< 默认采样周期（毫秒）
+    bool m_affinityPending{false};                        ///< 是否有待应用的CPU亲和性（受m_signalsMutex保护）
+    std::vector<unsigned> m_pendingAffinity;              ///< 待应用的CPU编号（受m_signalsMutex保护）
+    bool m_realtimePending{false};                        ///< 是否有待应用的实时配置（受m_signalsMutex保护）
+    RealtimeConfig m_pendingRealtime;                     ///< 待应用的实时配置（受m_signalsMutex保护）
+    RealtimeReport m_realtimeReport;                      ///< 实时配置的生效结果（受m_statsMutex保护）
 };
\ No newline at end of file
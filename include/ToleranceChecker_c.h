@@ -1,6 +1,9 @@
 #ifndef TOLERANCE_CHECKER_C_H
 #define TOLERANCE_CHECKER_C_H
 
+#include <stddef.h>
+#include "SharedSampleSegment_c.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -13,24 +16,248 @@ typedef enum {
     TC_SIGNAL_FAULT         // 故障状态
 } tc_signal_state_t;
 
+// 派发队列溢出策略
+typedef enum {
+    TC_OVERFLOW_DROP = 0,   // 丢弃新事件
+    TC_OVERFLOW_BLOCK       // 阻塞等待空位
+} tc_overflow_policy_t;
+
+// 采样超期处理策略
+typedef enum {
+    TC_OVERRUN_SKIP = 0,    // 跳过错过的采样点
+    TC_OVERRUN_CATCH_UP     // 逐个补采错过的采样点
+} tc_overrun_policy_t;
+
+// 线程调度策略
+typedef enum {
+    TC_SCHED_OTHER = 0,  // 普通分时调度
+    TC_SCHED_FIFO = 1,   // SCHED_FIFO实时调度
+    TC_SCHED_RR = 2      // SCHED_RR实时调度
+} tc_sched_policy_t;
+
+// 信号句柄：注册时返回，信号移除后自动失效；0 表示无效句柄
+typedef unsigned long long tc_handle_t;
+
+// 监控器实例（不透明类型）。各tc_checker_*函数的checker参数为NULL时作用于默认实例
+typedef struct tc_checker tc_checker_t;
+
+// 批量评估内核（不透明类型），见tc_kernel_*函数
+typedef struct tc_kernel tc_kernel_t;
+#define TC_INVALID_HANDLE 0ULL
+
+// 推送样本的评估时机
+typedef enum {
+    TC_PUSH_IMMEDIATE = 0,  // 立即评估
+    TC_PUSH_NEXT_TICK       // 下一次周期检查时评估
+} tc_push_mode_t;
+
 // 回调函数类型定义
 typedef void (*tc_warning_callback_t)(const char* signal_id, double value, void* ctx);
 typedef void (*tc_fault_callback_t)(const char* signal_id, double value, void* ctx);
 typedef double (*tc_value_callback_t)(const char* signal_id, void* ctx);
+// 信号组批量取值回调：按 handles 的顺序向 values 写入 count 个信号的当前值
+typedef void (*tc_batch_value_callback_t)(const tc_handle_t* handles, double* values, size_t count, void* ctx);
 
 // 信号配置结构
+// 使用前必须以 tc_signal_config_init() 初始化，再按需设置字段。
+// struct_size 标识调用者编译时的结构体版本，与本库的 sizeof(tc_signal_config_t) 不符时注册返回 TC_ERROR_INVALID_PARAM；
+// 未初始化的变量内容不确定，不保证能被识别
 typedef struct {
+    size_t struct_size;                 // 结构体大小（版本），由 tc_signal_config_init() 设置，须为第一个字段
     double target_value;                // 目标值
     double warning_threshold;           // 容差警告阈值（偏差的绝对值）
     double fault_threshold;             // 容差故障阈值（偏差的绝对值）
     tc_warning_callback_t warning_callback;  // 警告回调函数
     tc_fault_callback_t fault_callback;      // 故障回调函数
-    tc_value_callback_t value_callback;      // 获取信号值的回调函数
+    tc_value_callback_t value_callback;      // 获取信号值的回调函数（纯推送信号可为NULL）
     void* context;                      // 用户上下文指针（调用者负责生命周期管理）
     int tc_ms;                          // 等待时间（毫秒）
     int ts_ms;                          // 持续时间（毫秒）
+    int sample_period_ms;               // 采样周期（毫秒），<=0 使用默认周期
+    const char* group_id;               // 所属信号组（NULL 表示不分组），分组信号由组回调批量取值
+    tc_shm_segment_t* shared_segment;   // 共享内存样本段（NULL 表示不使用），非空时从 shared_slot 槽位读取样本
+    unsigned shared_slot;               // 共享内存样本段中的槽位下标
+    unsigned history_depth;             // 保存最近样本的个数（样本历史），0 表示不保存
+    double warning_exit_threshold;      // 警告退出阈值：进入 WARNING 或 FAULT 后偏差需回落到此值以内才恢复正常，<=0 表示与 warning_threshold 相同
+    double fault_exit_threshold;        // 故障退出阈值：进入 FAULT 后偏差需回落到此值以内才离开故障状态，低于 warning_threshold 时按 warning_threshold 处理，<=0 表示与 fault_threshold 相同
 } tc_signal_config_t;
 
+// 分片运行统计
+typedef struct {
+    unsigned long long signal_count;     // 分配到该分片的信号数量
+    unsigned long long passes;           // 已执行的检查轮数
+    unsigned long long checks;           // 已执行的信号检查次数
+    unsigned long long last_pass_us;     // 最近一轮耗时（微秒）
+    unsigned long long max_pass_us;      // 单轮最长耗时（微秒）
+    unsigned long long total_pass_us;    // 累计耗时（微秒）
+    unsigned long long max_lateness_us;  // 相对计划采样时间的最大滞后（微秒）
+} tc_shard_stats_t;
+
+// 信号状态快照（批量查询的结果项）
+typedef struct {
+    tc_handle_t handle;        // 信号句柄，信号不存在时为0
+    tc_signal_state_t state;   // 当前状态
+    double last_value;         // 最近参与分类的值，尚无样本时为NaN
+    long long since_ns;        // 进入当前状态的时间（CLOCK_MONOTONIC纳秒）
+} tc_signal_status_t;
+
+// 样本历史中的一个样本
+typedef struct {
+    long long timestamp_ns;  // 样本时间（CLOCK_MONOTONIC纳秒）
+    double value;            // 信号值
+} tc_history_sample_t;
+
+// 样本历史的内存占用
+typedef struct {
+    size_t limit_bytes;   // 内存上限（字节）
+    size_t used_bytes;    // 已注册信号的样本历史占用（字节）
+    size_t signal_count;  // 启用样本历史的信号数量
+} tc_history_memory_t;
+
+// 状态迁移事件
+typedef struct {
+    unsigned long long sequence;   // 事件序号（全局连续）
+    tc_handle_t handle;            // 信号句柄
+    tc_signal_state_t old_state;   // 迁移前状态
+    tc_signal_state_t new_state;   // 迁移后状态
+    double value;                  // 触发迁移的样本值
+    long long sample_time_ns;      // 样本时间（CLOCK_MONOTONIC纳秒）
+    long long publish_time_ns;     // 事件发布时间（CLOCK_MONOTONIC纳秒）
+} tc_transition_event_t;
+
+// 状态迁移批量回调：events 为一个批次的 count 个事件，只在回调期间有效
+typedef void (*tc_transition_batch_callback_t)(const tc_transition_event_t* events, size_t count, void* ctx);
+
+// 批量评估内核中单个信号的配置（tc/ts与评估时间使用调用者的时间单位）
+typedef struct {
+    double target_value;        // 目标值
+    double warning_threshold;   // 警告阈值
+    double fault_threshold;     // 故障阈值
+    long long tc;               // 配置后等待开始评估的时长
+    long long ts;               // 超出阈值后持续多久才进入对应状态
+} tc_kernel_signal_t;
+
+// 事件日志配置
+typedef struct {
+    const char* directory;       // 段文件目录，不存在时创建
+    const char* prefix;          // 段文件名前缀，NULL表示"journal"
+    size_t segment_bytes;        // 单个段文件的预分配大小（字节），0表示64MB
+    size_t max_segments;         // 最多保留的段文件数，0表示不删除
+    int record_samples;          // 非0时同时记录每个参与分类的原始样本
+} tc_journal_config_t;
+
+// 事件日志统计
+typedef struct {
+    int enabled;                    // 日志是否启用
+    unsigned long long records;     // 已写入的记录数
+    unsigned long long bytes;       // 已写入的字节数
+    unsigned long long segments;    // 已创建的段文件数
+    unsigned long long dropped;     // 因创建段文件失败而丢弃的记录数
+} tc_journal_stats_t;
+
+// 状态迁移批量回调配置
+typedef struct {
+    size_t max_batch;                      // 单批最多事件数，0表示1024
+    int max_latency_ms;                    // 合并窗口（毫秒）：批次中最早的事件最多等待多久交付，0表示每轮检查结束即交付
+    size_t queue_capacity;                 // 待交付批次的队列容量，0表示64
+    tc_overflow_policy_t overflow_policy;  // 队列满时的处理策略
+} tc_batch_config_t;
+
+// 状态迁移批量回调统计
+typedef struct {
+    int enabled;                      // 批量回调是否启用
+    unsigned long long batches;       // 已交付的批次数
+    unsigned long long events;        // 已交付的事件数
+    unsigned long long largest_batch; // 最大批次的事件数
+    unsigned long long dropped;       // 因队列满被丢弃的事件数
+    unsigned long long blocked;       // 因队列满而等待的移交次数
+    unsigned long long exceptions;    // 回调抛出异常的次数
+} tc_batch_stats_t;
+
+// 回调派发统计
+typedef struct {
+    unsigned long long submitted;   // 提交的事件数
+    unsigned long long delivered;   // 已调用回调的事件数
+    unsigned long long dropped;     // 因队列满被丢弃的事件数
+    unsigned long long blocked;     // 因队列满而等待的入队次数
+    unsigned long long exceptions;  // 回调抛出异常的次数
+} tc_dispatch_stats_t;
+
+// 监控循环运行统计
+typedef struct {
+    unsigned long long iterations;         // 循环轮数
+    unsigned long long timed_wakeups;      // 按截止时间唤醒的次数
+    unsigned long long last_jitter_us;     // 最近一次唤醒抖动（微秒）
+    unsigned long long max_jitter_us;      // 最大唤醒抖动（微秒）
+    unsigned long long total_jitter_us;    // 累计唤醒抖动（微秒）
+    unsigned long long overruns;           // 重新调度时下一个采样点已经过去的次数
+    unsigned long long skipped_samples;    // 跳过的采样点数量
+    unsigned long long worst_lateness_us;  // 开始采样时相对计划采样时间的最大滞后（微秒）
+} tc_loop_stats_t;
+
+// 延迟分布摘要（纳秒），分位数取所在直方图桶的上界
+typedef struct {
+    unsigned long long count;    // 样本数
+    unsigned long long mean_ns;  // 平均值
+    unsigned long long max_ns;   // 最大值
+    unsigned long long p50_ns;   // 50分位
+    unsigned long long p90_ns;   // 90分位
+    unsigned long long p99_ns;   // 99分位
+    unsigned long long p999_ns;  // 99.9分位
+} tc_histogram_t;
+
+// 热点路径统计
+typedef struct {
+    int enabled;                               // 是否正在记录统计
+    tc_histogram_t pass_latency;               // 每轮检查耗时
+    tc_histogram_t lock_hold;                  // 监控线程持有注册表锁的时长
+    tc_histogram_t wake_jitter;                // 按截止时间唤醒的抖动
+    tc_histogram_t group_fetch_latency;        // 信号组批量取值回调耗时
+    unsigned long long samples;                // 参与分类的样本数
+    unsigned long long warning_transitions;    // 进入WARNING的次数
+    unsigned long long fault_transitions;      // 进入FAULT的次数
+    unsigned long long recoveries;             // 恢复到NORMAL的次数
+    unsigned long long value_errors;           // 取值回调失败的次数
+    unsigned long long callback_exceptions;    // 警告/故障回调抛出异常的次数
+    unsigned long long overruns;               // 采样超期次数
+} tc_stats_t;
+
+// 单个信号的统计
+typedef struct {
+    tc_histogram_t value_latency;              // 取值回调耗时
+    unsigned long long samples;                // 参与分类的样本数
+    unsigned long long warning_transitions;    // 进入WARNING的次数
+    unsigned long long fault_transitions;      // 进入FAULT的次数
+    unsigned long long recoveries;             // 恢复到NORMAL的次数
+    unsigned long long value_errors;           // 取值回调失败的次数
+} tc_signal_stats_t;
+
+// 实时线程配置
+typedef struct {
+    tc_sched_policy_t policy;        // 调度策略
+    int priority;                    // 实时优先级（FIFO/RR为1~99）
+    const unsigned* cpus;            // 允许运行的CPU编号数组，可为NULL
+    size_t cpu_count;                // CPU数量，0表示不修改亲和性
+    int lock_memory;                 // 非0时以mlockall锁定进程内存
+    size_t prefault_stack_bytes;     // 预先触碰的栈空间（字节），0表示不预取
+} tc_realtime_config_t;
+
+#define TC_REALTIME_MAX_CPUS 256
+
+// 实时配置的实际生效结果（调度策略、优先级与CPU均从内核读回）
+typedef struct {
+    int applied;                          // 配置是否已应用
+    tc_sched_policy_t policy;             // 实际调度策略
+    int priority;                         // 实际优先级
+    int scheduling_error;                 // 设置调度策略失败时的errno
+    unsigned cpus[TC_REALTIME_MAX_CPUS];  // 实际可运行的CPU
+    size_t cpu_count;                     // cpus中的有效数量
+    int affinity_error;                   // 设置CPU亲和性失败时的errno
+    int memory_locked;                    // 内存是否已锁定
+    int memory_lock_error;                // mlockall失败时的errno
+    size_t stack_prefaulted;              // 实际预取的栈空间（字节）
+} tc_realtime_report_t;
+
 /**
  * 重要说明：context 生命周期管理
  * 
@@ -47,17 +274,73 @@ typedef struct {
 #define TC_ERROR_NOT_FOUND  -3    // 信号未找到
 #define TC_ERROR_MONITORING -4    // 监控状态错误
 #define TC_ERROR_NULL_PTR   -5    // 空指针错误
+#define TC_ERROR_OVERRUN    -6    // 事件流读取位置已被覆盖，需要重新同步
+#define TC_ERROR_INVALID_PARAM -7 // 参数无效（如信号配置未经 tc_signal_config_init() 初始化）
 
-// API 函数声明
+// API 函数声明（作用于默认实例）
+
+/**
+ * 初始化信号配置：全部字段清零（不分组、不使用共享内存、不保存历史、无滞回）并设置 struct_size
+ * @param config 信号配置结构指针
+ * 
+ * 注册前必须调用，之后再设置目标值、阈值与回调等字段
+ */
+void tc_signal_config_init(tc_signal_config_t* config);
 
 /**
  * 注册信号
  * @param signal_id 信号ID字符串
- * @param config 信号配置结构指针
- * @return 成功返回TC_SUCCESS，失败返回错误码
+ * @param config 信号配置结构指针（须经 tc_signal_config_init() 初始化）
+ * @return 成功返回TC_SUCCESS，配置的 struct_size 不符返回TC_ERROR_INVALID_PARAM，失败返回错误码
  */
 int tc_register_signal(const char* signal_id, const tc_signal_config_t* config);
 
+/**
+ * 注册信号并返回句柄
+ * @param signal_id 信号ID字符串
+ * @param config 信号配置结构指针（须经 tc_signal_config_init() 初始化）
+ * @param handle 输出参数，存储信号句柄，可为NULL
+ * @return 成功返回TC_SUCCESS，配置的 struct_size 不符返回TC_ERROR_INVALID_PARAM，失败返回错误码
+ */
+int tc_register_signal_with_handle(const char* signal_id, const tc_signal_config_t* config, tc_handle_t* handle);
+
+/**
+ * 批量注册信号，整批信号在一次注册表发布中对监控线程可见
+ * @param signal_ids 信号ID字符串数组
+ * @param configs 信号配置数组，与signal_ids一一对应
+ * @param count 信号数量
+ * @param handles 输出参数，与signal_ids一一对应的句柄数组，注册失败的项为0，可为NULL
+ * @param registered 输出参数，成功注册的数量，可为NULL
+ * @return 全部成功返回TC_SUCCESS，部分信号ID重复或信号组未注册时返回TC_ERROR_EXISTS，
+ *         任一配置的 struct_size 不符时不注册任何信号并返回TC_ERROR_INVALID_PARAM
+ */
+int tc_register_signals(const char* const* signal_ids, const tc_signal_config_t* configs, size_t count,
+                        tc_handle_t* handles, size_t* registered);
+
+/**
+ * 按ID查找信号句柄（仅用于发现，后续调用应使用句柄）
+ * @param signal_id 信号ID字符串
+ * @param handle 输出参数，存储信号句柄
+ * @return 成功返回TC_SUCCESS，未找到返回TC_ERROR_NOT_FOUND
+ */
+int tc_find_signal(const char* signal_id, tc_handle_t* handle);
+
+/**
+ * 注册信号组
+ * @param group_id 信号组ID字符串
+ * @param callback 批量取值回调，每轮对组内到期的信号只调用一次
+ * @param ctx 用户上下文指针（调用者负责生命周期管理）
+ * @return 成功返回TC_SUCCESS，组已存在返回TC_ERROR_EXISTS
+ */
+int tc_register_signal_group(const char* group_id, tc_batch_value_callback_t callback, void* ctx);
+
+/**
+ * 移除信号组
+ * @param group_id 信号组ID字符串
+ * @return 成功返回TC_SUCCESS，未找到返回TC_ERROR_NOT_FOUND
+ */
+int tc_remove_signal_group(const char* group_id);
+
 /**
  * 停止监控
  * @return 成功返回TC_SUCCESS，失败返回错误码
@@ -77,6 +360,22 @@ int tc_is_monitoring(void);
  */
 int tc_remove_signal(const char* signal_id);
 
+/**
+ * 按句柄移除信号
+ * @param handle 信号句柄
+ * @return 成功返回TC_SUCCESS，句柄失效返回TC_ERROR_NOT_FOUND
+ */
+int tc_remove_signal_by_handle(tc_handle_t handle);
+
+/**
+ * 按句柄批量移除信号，注册表只发布一次
+ * @param handles 信号句柄数组
+ * @param count 句柄数量
+ * @param removed 输出参数，实际移除的数量，可为NULL
+ * @return 全部移除返回TC_SUCCESS，存在失效句柄时返回TC_ERROR_NOT_FOUND
+ */
+int tc_remove_signals(const tc_handle_t* handles, size_t count, size_t* removed);
+
 /**
  * 获取信号状态
  * @param signal_id 信号ID字符串
@@ -85,6 +384,443 @@ int tc_remove_signal(const char* signal_id);
  */
 int tc_get_signal_state(const char* signal_id, tc_signal_state_t* state);
 
+/**
+ * 按句柄获取信号状态
+ * @param handle 信号句柄
+ * @param state 输出参数，存储信号状态
+ * @return 成功返回TC_SUCCESS，句柄失效返回TC_ERROR_NOT_FOUND
+ */
+int tc_get_signal_state_by_handle(tc_handle_t handle, tc_signal_state_t* state);
+
+/**
+ * 批量读取所有已注册信号的状态（一次读取注册表快照，按槽位顺序输出）
+ * @param states 调用者提供的输出数组
+ * @param capacity 输出数组容量
+ * @param count 输出参数，已注册信号的总数；大于capacity时只写入前capacity项
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_get_signal_states(tc_signal_status_t* states, size_t capacity, size_t* count);
+
+/**
+ * 按句柄批量读取信号状态
+ * @param handles 信号句柄数组
+ * @param count 句柄数量
+ * @param states 调用者提供的输出数组，与handles一一对应，失效句柄对应项的handle为0
+ * @return 全部有效返回TC_SUCCESS，存在失效句柄时返回TC_ERROR_NOT_FOUND
+ */
+int tc_get_signal_states_by_handle(const tc_handle_t* handles, size_t count, tc_signal_status_t* states);
+
+/**
+ * 导出信号的样本历史（可在故障/警告回调中调用）
+ * @param handle 信号句柄
+ * @param samples 调用者提供的输出数组，按时间从旧到新写入
+ * @param capacity 输出数组容量，小于已保存的样本数时只导出最新的部分
+ * @param count 输出参数，实际导出的样本数
+ * @return 成功返回TC_SUCCESS，句柄失效时返回TC_ERROR_NOT_FOUND；未启用样本历史的信号导出0个样本
+ */
+int tc_export_sample_history(tc_handle_t handle, tc_history_sample_t* samples, size_t capacity, size_t* count);
+
+/**
+ * 设置样本历史的总内存上限（只影响之后的注册，超出上限的信号注册失败）
+ * @param bytes 上限（字节），默认64MB
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_set_history_memory_limit(size_t bytes);
+
+/**
+ * 获取样本历史的内存占用
+ * @param usage 输出参数
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_get_history_memory(tc_history_memory_t* usage);
+
+/**
+ * 推送信号样本
+ * @param signal_id 信号ID字符串
+ * @param value 信号值
+ * @param timestamp_ns 样本源时间戳，CLOCK_MONOTONIC纳秒；0表示使用当前时间
+ * @param mode 评估时机
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_push_value(const char* signal_id, double value, long long timestamp_ns, tc_push_mode_t mode);
+
+/**
+ * 按句柄推送信号样本
+ * @param handle 信号句柄
+ * @param value 信号值
+ * @param timestamp_ns 样本源时间戳，CLOCK_MONOTONIC纳秒；0表示使用当前时间
+ * @param mode 评估时机
+ * @return 成功返回TC_SUCCESS，句柄失效返回TC_ERROR_NOT_FOUND
+ */
+int tc_push_value_by_handle(tc_handle_t handle, double value, long long timestamp_ns, tc_push_mode_t mode);
+
+/**
+ * 配置分片监控模式
+ * @param worker_count 工作线程数量，0表示在监控线程上顺序检查
+ * @param shard_count 分片数量，0表示自动选择
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_configure_sharding(unsigned worker_count, unsigned shard_count);
+
+/**
+ * 获取各分片运行统计
+ * @param stats 输出数组，可为NULL（仅查询分片数量）
+ * @param capacity 输出数组容量
+ * @param count 输出参数，存储分片总数
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_get_shard_stats(tc_shard_stats_t* stats, int capacity, int* count);
+
+/**
+ * 配置异步回调派发
+ * @param thread_count 派发线程数量，0表示在检查线程上直接调用回调
+ * @param queue_capacity 每个派发线程的队列容量
+ * @param policy 队列满时的处理策略
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_configure_dispatch(unsigned thread_count, unsigned queue_capacity, tc_overflow_policy_t policy);
+
+/**
+ * 获取回调派发统计
+ * @param stats 输出参数，存储派发统计
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_get_dispatch_stats(tc_dispatch_stats_t* stats);
+
+/**
+ * 设置采样超期处理策略
+ * @param policy 处理策略
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_set_overrun_policy(tc_overrun_policy_t policy);
+
+/**
+ * 获取监控循环的抖动、超期与滞后统计
+ * @param stats 输出参数，存储循环统计
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_get_loop_stats(tc_loop_stats_t* stats);
+
+/**
+ * 启用或停用热点路径统计
+ * @param enabled 非0为启用
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_enable_stats(int enabled);
+
+/**
+ * 获取热点路径统计
+ * @param stats 输出参数，存储统计
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_get_stats(tc_stats_t* stats);
+
+/**
+ * 获取单个信号的统计
+ * @param handle 信号句柄
+ * @param stats 输出参数，存储信号统计
+ * @return 成功返回TC_SUCCESS，句柄失效或未启用统计返回TC_ERROR_NOT_FOUND
+ */
+int tc_get_signal_stats(tc_handle_t handle, tc_signal_stats_t* stats);
+
+/**
+ * 启用或停用状态迁移事件流
+ * @param capacity 事件流容量（向上取整为2的幂），0表示停用
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_enable_transition_stream(size_t capacity);
+
+/**
+ * 订阅状态迁移事件流
+ * @param cursor 输出参数，新消费者的读取位置
+ * @return 成功返回TC_SUCCESS，事件流未启用返回TC_ERROR_MONITORING
+ */
+int tc_subscribe_transitions(unsigned long long* cursor);
+
+/**
+ * 批量读取状态迁移事件（各消费者持有自己的读取位置，无锁）
+ * @param cursor 输入输出参数，读取位置，返回时指向下一个未读事件
+ * @param events 调用者提供的输出数组
+ * @param capacity 输出数组容量
+ * @param count 输出参数，实际读出的事件数量
+ * @return 成功返回TC_SUCCESS；读取位置已被覆盖返回TC_ERROR_OVERRUN（已读出的事件仍然有效），
+ *         应调用tc_resync_transitions()；事件流未启用返回TC_ERROR_MONITORING
+ */
+int tc_read_transitions(unsigned long long* cursor, tc_transition_event_t* events, size_t capacity, size_t* count);
+
+/**
+ * 溢出后重新同步：读取状态快照并返回新的读取位置
+ * @param cursor 输出参数，新的读取位置
+ * @param states 调用者提供的状态输出数组
+ * @param capacity 输出数组容量
+ * @param count 输出参数，已注册信号的总数；大于capacity时只写入前capacity项
+ * @return 成功返回TC_SUCCESS，事件流未启用返回TC_ERROR_MONITORING
+ */
+int tc_resync_transitions(unsigned long long* cursor, tc_signal_status_t* states, size_t capacity, size_t* count);
+
+/**
+ * 启用事件日志（状态迁移与可选的原始样本经内存映射写入段文件，可用ToleranceJournalTool离线查询）
+ * @param config 日志配置
+ * @return 成功返回TC_SUCCESS，目录或段文件无法创建时返回TC_ERROR_GENERAL
+ */
+int tc_enable_journal(const tc_journal_config_t* config);
+
+/**
+ * 停用事件日志
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_disable_journal(void);
+
+/**
+ * 获取事件日志统计
+ * @param stats 输出参数
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_get_journal_stats(tc_journal_stats_t* stats);
+
+/**
+ * 设置状态迁移批量回调（同一轮检查或合并窗口内的迁移合并为一个数组，由专用交付线程整批调用）
+ * @param callback 批量回调，NULL表示停用
+ * @param config 交付配置，NULL表示使用默认配置
+ * @param ctx 传给回调的用户上下文指针（调用者负责生命周期管理）
+ * @return 成功返回TC_SUCCESS，在批量回调内调用时返回TC_ERROR_GENERAL，其他失败返回错误码
+ *
+ * 返回前旧回调已交付完剩余的批次，此后不会再被调用，旧回调的 ctx 可以释放。
+ * 批量回调内可以调用 tc_get_transition_batch_stats，但不能设置批量回调
+ */
+int tc_set_transition_batch_callback(tc_transition_batch_callback_t callback, const tc_batch_config_t* config,
+                                     void* ctx);
+
+/**
+ * 获取状态迁移批量回调统计
+ * @param stats 输出参数
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_get_transition_batch_stats(tc_batch_stats_t* stats);
+
+// 多实例接口
+
+/**
+ * 创建独立的监控器实例（拥有自己的监控线程与注册表，创建后不会自动开始监控）
+ * @param default_sample_period_ms 未配置采样周期的信号使用的默认周期（毫秒），<=0 时取100
+ * @return 实例指针，失败返回NULL
+ */
+tc_checker_t* tc_checker_create(int default_sample_period_ms);
+
+/**
+ * 停止监控并销毁实例（不可用于默认实例）
+ * @param checker 由tc_checker_create()创建的实例，可为NULL
+ */
+void tc_checker_destroy(tc_checker_t* checker);
+
+/**
+ * 开始监控
+ * @param checker 监控器实例，NULL表示默认实例
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_checker_start_monitoring(tc_checker_t* checker);
+
+/**
+ * 设置监控线程与分片工作线程的CPU亲和性（仅Linux平台生效）
+ * @param checker 监控器实例，NULL表示默认实例
+ * @param cpus 允许运行的CPU编号数组
+ * @param count CPU数量，0表示解除绑定
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_checker_set_cpu_affinity(tc_checker_t* checker, const unsigned* cpus, size_t count);
+
+/**
+ * 配置监控线程的实时调度、CPU亲和性、内存锁定与栈预取（仅Linux平台生效）
+ * @param checker 监控器实例，NULL表示默认实例
+ * @param config 实时配置
+ * @return 成功返回TC_SUCCESS，失败返回错误码；实际生效情况通过tc_checker_get_realtime_report查询
+ */
+int tc_checker_configure_realtime(tc_checker_t* checker, const tc_realtime_config_t* config);
+
+/**
+ * 获取实时配置的实际生效结果
+ * @param checker 监控器实例，NULL表示默认实例
+ * @param report 输出参数，尚未应用时applied为0
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_checker_get_realtime_report(tc_checker_t* checker, tc_realtime_report_t* report);
+
+/** 同tc_register_signal，作用于checker指定的实例 */
+int tc_checker_register_signal(tc_checker_t* checker, const char* signal_id,
+                               const tc_signal_config_t* config);
+
+/** 同tc_register_signal_with_handle，作用于checker指定的实例 */
+int tc_checker_register_signal_with_handle(tc_checker_t* checker, const char* signal_id,
+                                           const tc_signal_config_t* config, tc_handle_t* handle);
+
+/** 同tc_register_signals，作用于checker指定的实例 */
+int tc_checker_register_signals(tc_checker_t* checker, const char* const* signal_ids,
+                                const tc_signal_config_t* configs, size_t count, tc_handle_t* handles,
+                                size_t* registered);
+
+/** 同tc_find_signal，作用于checker指定的实例 */
+int tc_checker_find_signal(tc_checker_t* checker, const char* signal_id, tc_handle_t* handle);
+
+/** 同tc_register_signal_group，作用于checker指定的实例 */
+int tc_checker_register_signal_group(tc_checker_t* checker, const char* group_id,
+                                     tc_batch_value_callback_t callback, void* ctx);
+
+/** 同tc_remove_signal_group，作用于checker指定的实例 */
+int tc_checker_remove_signal_group(tc_checker_t* checker, const char* group_id);
+
+/** 同tc_stop_monitoring，作用于checker指定的实例 */
+int tc_checker_stop_monitoring(tc_checker_t* checker);
+
+/** 同tc_is_monitoring，作用于checker指定的实例 */
+int tc_checker_is_monitoring(tc_checker_t* checker);
+
+/** 同tc_remove_signal，作用于checker指定的实例 */
+int tc_checker_remove_signal(tc_checker_t* checker, const char* signal_id);
+
+/** 同tc_remove_signal_by_handle，作用于checker指定的实例 */
+int tc_checker_remove_signal_by_handle(tc_checker_t* checker, tc_handle_t handle);
+
+/** 同tc_remove_signals，作用于checker指定的实例 */
+int tc_checker_remove_signals(tc_checker_t* checker, const tc_handle_t* handles, size_t count,
+                              size_t* removed);
+
+/** 同tc_get_signal_state，作用于checker指定的实例 */
+int tc_checker_get_signal_state(tc_checker_t* checker, const char* signal_id, tc_signal_state_t* state);
+
+/** 同tc_get_signal_state_by_handle，作用于checker指定的实例 */
+int tc_checker_get_signal_state_by_handle(tc_checker_t* checker, tc_handle_t handle,
+                                          tc_signal_state_t* state);
+
+/** 同tc_get_signal_states，作用于checker指定的实例 */
+int tc_checker_get_signal_states(tc_checker_t* checker, tc_signal_status_t* states, size_t capacity,
+                                 size_t* count);
+
+/** 同tc_get_signal_states_by_handle，作用于checker指定的实例 */
+int tc_checker_get_signal_states_by_handle(tc_checker_t* checker, const tc_handle_t* handles, size_t count,
+                                           tc_signal_status_t* states);
+
+/** 同tc_export_sample_history，作用于checker指定的实例 */
+int tc_checker_export_sample_history(tc_checker_t* checker, tc_handle_t handle, tc_history_sample_t* samples,
+                                     size_t capacity, size_t* count);
+
+/** 同tc_set_history_memory_limit，作用于checker指定的实例 */
+int tc_checker_set_history_memory_limit(tc_checker_t* checker, size_t bytes);
+
+/** 同tc_get_history_memory，作用于checker指定的实例 */
+int tc_checker_get_history_memory(tc_checker_t* checker, tc_history_memory_t* usage);
+
+/** 同tc_push_value，作用于checker指定的实例 */
+int tc_checker_push_value(tc_checker_t* checker, const char* signal_id, double value, long long timestamp_ns,
+                          tc_push_mode_t mode);
+
+/** 同tc_push_value_by_handle，作用于checker指定的实例 */
+int tc_checker_push_value_by_handle(tc_checker_t* checker, tc_handle_t handle, double value,
+                                    long long timestamp_ns, tc_push_mode_t mode);
+
+/** 同tc_configure_sharding，作用于checker指定的实例 */
+int tc_checker_configure_sharding(tc_checker_t* checker, unsigned worker_count, unsigned shard_count);
+
+/** 同tc_get_shard_stats，作用于checker指定的实例 */
+int tc_checker_get_shard_stats(tc_checker_t* checker, tc_shard_stats_t* stats, int capacity, int* count);
+
+/** 同tc_configure_dispatch，作用于checker指定的实例 */
+int tc_checker_configure_dispatch(tc_checker_t* checker, unsigned thread_count, unsigned queue_capacity,
+                                  tc_overflow_policy_t policy);
+
+/** 同tc_get_dispatch_stats，作用于checker指定的实例 */
+int tc_checker_get_dispatch_stats(tc_checker_t* checker, tc_dispatch_stats_t* stats);
+
+/** 同tc_set_overrun_policy，作用于checker指定的实例 */
+int tc_checker_set_overrun_policy(tc_checker_t* checker, tc_overrun_policy_t policy);
+
+/** 同tc_get_loop_stats，作用于checker指定的实例 */
+int tc_checker_get_loop_stats(tc_checker_t* checker, tc_loop_stats_t* stats);
+
+/** 同tc_enable_stats，作用于checker指定的实例 */
+int tc_checker_enable_stats(tc_checker_t* checker, int enabled);
+
+/** 同tc_get_stats，作用于checker指定的实例 */
+int tc_checker_get_stats(tc_checker_t* checker, tc_stats_t* stats);
+
+/** 同tc_get_signal_stats，作用于checker指定的实例 */
+int tc_checker_get_signal_stats(tc_checker_t* checker, tc_handle_t handle, tc_signal_stats_t* stats);
+
+/** 同tc_enable_transition_stream，作用于checker指定的实例 */
+int tc_checker_enable_transition_stream(tc_checker_t* checker, size_t capacity);
+
+/** 同tc_subscribe_transitions，作用于checker指定的实例 */
+int tc_checker_subscribe_transitions(tc_checker_t* checker, unsigned long long* cursor);
+
+/** 同tc_read_transitions，作用于checker指定的实例 */
+int tc_checker_read_transitions(tc_checker_t* checker, unsigned long long* cursor,
+                                tc_transition_event_t* events, size_t capacity, size_t* count);
+
+/** 同tc_resync_transitions，作用于checker指定的实例 */
+int tc_checker_resync_transitions(tc_checker_t* checker, unsigned long long* cursor,
+                                  tc_signal_status_t* states, size_t capacity, size_t* count);
+
+/** 同tc_enable_journal，作用于checker指定的实例 */
+int tc_checker_enable_journal(tc_checker_t* checker, const tc_journal_config_t* config);
+
+/** 同tc_disable_journal，作用于checker指定的实例 */
+int tc_checker_disable_journal(tc_checker_t* checker);
+
+/** 同tc_get_journal_stats，作用于checker指定的实例 */
+int tc_checker_get_journal_stats(tc_checker_t* checker, tc_journal_stats_t* stats);
+
+/** 同tc_set_transition_batch_callback，作用于checker指定的实例 */
+int tc_checker_set_transition_batch_callback(tc_checker_t* checker, tc_transition_batch_callback_t callback,
+                                             const tc_batch_config_t* config, void* ctx);
+
+/** 同tc_get_transition_batch_stats，作用于checker指定的实例 */
+int tc_checker_get_transition_batch_stats(tc_checker_t* checker, tc_batch_stats_t* stats);
+
+// 批量评估内核：不创建线程、不调用回调，供已在连续数组中持有全部信号值的宿主控制循环直接调用
+
+/**
+ * 创建批量评估内核
+ * @param signals 各信号的配置，signals[i]对应值数组中的第i个值；count为0时可为NULL
+ * @param count 信号数量
+ * @param now 当前时间，tc等待期由此开始
+ * @return 内核指针，失败返回NULL
+ */
+tc_kernel_t* tc_kernel_create(const tc_kernel_signal_t* signals, size_t count, long long now);
+
+/**
+ * 销毁批量评估内核
+ * @param kernel 内核，可为NULL
+ */
+void tc_kernel_destroy(tc_kernel_t* kernel);
+
+/**
+ * 追加信号
+ * @param kernel 内核
+ * @param signal 信号配置
+ * @param now 当前时间
+ * @param index 输出参数，新信号的下标，可为NULL
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_kernel_add_signal(tc_kernel_t* kernel, const tc_kernel_signal_t* signal, long long now, size_t* index);
+
+/**
+ * 重新配置信号并复位其状态（UNKNOWN，tc等待期自now重新开始）
+ * @return 成功返回TC_SUCCESS，下标越界返回TC_ERROR_NOT_FOUND
+ */
+int tc_kernel_configure(tc_kernel_t* kernel, size_t index, const tc_kernel_signal_t* signal, long long now);
+
+/**
+ * 批量评估（分类与去抖）
+ * @param kernel 内核
+ * @param values 信号值，values[i]对应下标i的信号
+ * @param count 评估的信号数量（前count个），超出信号数量的部分被忽略
+ * @param now 本次评估的时间，应单调不减
+ * @param states 输出各信号评估后的状态，可为NULL
+ * @param changed 输出参数，本次状态发生变化的信号数量，可为NULL
+ * @return 成功返回TC_SUCCESS，失败返回错误码
+ */
+int tc_kernel_evaluate(tc_kernel_t* kernel, const double* values, size_t count, long long now,
+                       tc_signal_state_t* states, size_t* changed);
+
 /**
  * 获取状态名称字符串（用于调试）
  * @param state 信号状态
@@ -0,0 +1,113 @@
+/**
+ * @file ToleranceKernel.h
+ * @brief 无线程批量评估内核头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了供宿主控制循环直接调用的批量评估内核：
+ * 宿主每个周期把全部信号值放在一个连续的double数组中，内核按紧凑的阈值/计时表
+ * 完成与监控器相同的NORMAL/WARNING/FAULT分类与tc/ts去抖，不创建线程、不调用回调。
+ */
+
+#pragma once
+
+#include "SignalState.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 宿主时间刻度
+ *
+ * 单调递增的整数时间，单位由宿主决定（如纳秒或控制周期数），tc与ts使用相同单位
+ */
+using TickTime = std::int64_t;
+
+/**
+ * @brief 内核中单个信号的配置
+ */
+struct KernelSignalConfig {
+    double targetValue{0.0};        ///< 目标值
+    double warningThreshold{0.0};   ///< 警告阈值
+    double faultThreshold{0.0};     ///< 故障阈值
+    TickTime tc{0};                 ///< tc时间：配置后等待开始评估的时长
+    TickTime ts{0};                 ///< ts时间：超出阈值后持续多久才进入对应状态
+};
+
+/**
+ * @brief 批量评估内核
+ *
+ * 信号按下标（0..size()-1）与宿主的值数组一一对应。阈值、去抖计时与状态均按结构数组存放，
+ * 分类使用SignalHotStore的向量内核，去抖为无分支的连续循环。
+ * 语义与监控器一致：偏差<=警告阈值立即回到NORMAL；超出阈值持续ts后进入WARNING/FAULT；
+ * 配置后tc内的样本不参与评估，状态保持UNKNOWN。
+ *
+ * 非线程安全：同一实例的配置与评估应在同一线程上进行（不同实例之间互不影响）
+ */
+class ToleranceKernel {
+public:
+    /**
+     * @brief 构造空内核
+     */
+    ToleranceKernel() = default;
+
+    /**
+     * @brief 按配置表构造内核
+     * @param configs 各信号的配置
+     * @param count 信号数量
+     * @param now 当前时间，tc等待期由此开始
+     */
+    ToleranceKernel(const KernelSignalConfig* configs, std::size_t count, TickTime now);
+
+    /**
+     * @brief 追加信号
+     * @return 新信号的下标
+     */
+    std::size_t addSignal(const KernelSignalConfig& config, TickTime now);
+
+    /**
+     * @brief 重新配置信号并复位其状态（UNKNOWN，tc等待期自now重新开始）
+     * @return 下标越界时返回false
+     */
+    bool configure(std::size_t index, const KernelSignalConfig& config, TickTime now);
+
+    /**
+     * @brief 批量评估
+     * @param values 信号值，values[i]对应下标i的信号
+     * @param count 评估的信号数量（前count个），超出size()的部分被忽略
+     * @param now 本次评估的时间，应单调不减
+     * @param out 输出各信号评估后的状态，可为空
+     * @return 本次状态发生变化的信号数量
+     */
+    std::size_t evaluate(const double* values, std::size_t count, TickTime now, SignalState* out);
+
+    /**
+     * @brief 获取信号数量
+     */
+    std::size_t size() const { return m_targets.size(); }
+
+    /**
+     * @brief 获取信号当前状态
+     */
+    SignalState state(std::size_t index) const { return static_cast<SignalState>(m_states[index]); }
+
+    /**
+     * @brief 获取全部信号的当前状态（SignalState取值，长度为size()）
+     */
+    const std::uint8_t* states() const { return m_states.data(); }
+
+private:
+    static constexpr TickTime kInactive = INT64_MAX;  ///< 计时未开始
+    static constexpr std::size_t kChunk = 512;        ///< 分类结果缓冲区长度，保持在L1缓存内
+
+    std::vector<double> m_targets;            ///< 目标值
+    std::vector<double> m_warningThresholds;  ///< 警告阈值
+    std::vector<double> m_faultThresholds;    ///< 故障阈值
+    std::vector<TickTime> m_settleTimes;      ///< tc等待期结束时间
+    std::vector<TickTime> m_ts;               ///< ts时间
+    std::vector<TickTime> m_warningSince;     ///< 警告计时开始时间
+    std::vector<TickTime> m_faultSince;       ///< 故障计时开始时间
+    std::vector<std::uint8_t> m_states;       ///< 当前状态
+    std::uint8_t m_bands[kChunk];             ///< 分类结果缓冲区
+};
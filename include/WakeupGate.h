@@ -0,0 +1,61 @@
+/**
+ * @file WakeupGate.h
+ * @brief 单消费者线程的休眠与唤醒头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了无锁队列消费者线程的休眠门：队列为空时消费者在条件变量上休眠，
+ * 生产者入队后只在消费者确实休眠时才加锁唤醒，热路径上只有一次内存屏障和一次原子读取。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * @brief 单消费者线程的休眠门
+ *
+ * 消费者先写入sleeping再复查工作条件，生产者先发布工作再读取sleeping，
+ * 两侧之间的全序屏障构成Dekker式握手：至少一方能看到对方的写入，不会丢失唤醒。
+ * wait()只能由一个消费者线程调用；notify()可由任意线程并发调用。
+ */
+class WakeupGate {
+public:
+    /**
+     * @brief 消费者在没有工作时休眠，直到被唤醒或ready()为真
+     * @param ready 工作条件（如队列非空或已请求停止），可能在持有内部锁时被调用
+     */
+    template <typename Ready>
+    void wait(Ready&& ready) {
+        m_sleeping.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ready()) {
+            m_sleeping.store(false);
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wakeUp.wait(lock, [&] { return !m_sleeping.load() || ready(); });
+    }
+
+    /**
+     * @brief 生产者发布工作（入队、置停止标志等）之后调用，消费者休眠时将其唤醒
+     */
+    void notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_sleeping.load()) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_sleeping.store(false);
+            }
+            m_wakeUp.notify_one();
+        }
+    }
+
+private:
+    std::atomic<bool> m_sleeping{false};  ///< 消费者是否准备休眠
+    std::mutex m_mutex;                   ///< 休眠用互斥锁
+    std::condition_variable m_wakeUp;     ///< 唤醒消费者
+};
@@ -0,0 +1,103 @@
+/**
+ * @file WorkerPool.h
+ * @brief 工作窃取线程池头文件
+ * @author ToleranceMonitor Team
+ * @version 1.0.0
+ * @date 2024
+ *
+ * 此头文件定义了分片监控模式使用的工作窃取（work stealing）线程池。
+ * 每个工作线程拥有自己的任务队列，空闲时从其他线程的队列尾部窃取任务，
+ * 使回调耗时较长的分片不会拖慢整轮检查。
+ */
+
+#pragma once
+
+#include "RealtimeThread.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 工作窃取线程池
+ *
+ * 以批次为单位执行任务：run()将任务轮流分发到各工作线程的队列，
+ * 工作线程从自己队列头部取任务，队列为空时从其他队列尾部窃取；
+ * 调用线程本身也参与窃取，直到整批任务完成才返回。
+ *
+ * 同一时刻只允许一个线程调用run()。
+ */
+class WorkerPool {
+public:
+    using Task = std::function<void()>;  ///< 任务类型
+
+    /**
+     * @brief 构造线程池并启动工作线程
+     * @param workerCount 工作线程数量，至少为1
+     */
+    explicit WorkerPool(unsigned workerCount);
+
+    /**
+     * @brief 析构函数
+     * 通知并等待所有工作线程退出
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;            ///< 禁用拷贝构造
+    WorkerPool& operator=(const WorkerPool&) = delete; ///< 禁用拷贝赋值
+
+    /**
+     * @brief 执行一批任务并等待全部完成
+     * @param tasks 任务列表，执行期间调用者须保证其有效
+     */
+    void run(std::vector<Task>& tasks);
+
+    /**
+     * @brief 获取工作线程数量
+     */
+    unsigned workerCount() const { return static_cast<unsigned>(m_workers.size()); }
+
+    /**
+     * @brief 设置所有工作线程的CPU亲和性
+     * @param cpus 允许运行的CPU编号，为空时允许运行在所有CPU上
+     * @return 全部设置成功返回true
+     */
+    bool setAffinity(const std::vector<unsigned>& cpus);
+
+    /**
+     * @brief 设置所有工作线程的调度策略与优先级
+     * @return 全部设置成功返回true
+     */
+    bool setScheduling(SchedulingPolicy policy, int priority);
+
+private:
+    /**
+     * @brief 单个工作线程的任务队列
+     */
+    struct Worker {
+        std::mutex mutex;         ///< 队列互斥锁
+        std::deque<Task*> queue;  ///< 任务队列（头部自取，尾部被窃取）
+    };
+
+    Task* popLocal(std::size_t index);
+    Task* steal(std::size_t thief);
+    void execute(Task* task);
+    void workerLoop(std::size_t index);
+
+private:
+    std::vector<std::unique_ptr<Worker>> m_workers;  ///< 各工作线程的队列
+    std::vector<std::thread> m_threads;              ///< 工作线程
+
+    std::mutex m_mutex;                              ///< 批次状态互斥锁
+    std::condition_variable m_workAvailable;         ///< 新批次通知
+    std::condition_variable m_batchDone;             ///< 批次完成通知
+    std::atomic<std::size_t> m_pending{0};           ///< 本批未完成任务数
+    std::uint64_t m_generation{0};                   ///< 批次序号
+    bool m_stopping{false};                          ///< 线程池停止标志
+};
@@ -0,0 +1,111 @@
+#include "CallbackDispatcher.h"
+#include "ToleranceChecker.h"
+#include "Logger.h"
+
+CallbackDispatcher::~CallbackDispatcher() {
+    stop();
+}
+
+void CallbackDispatcher::start(unsigned threadCount, std::size_t queueCapacity, OverflowPolicy policy) {
+    stop();
+    if (threadCount == 0) {
+        return;
+    }
+
+    m_policy = policy;
+    m_stopping.store(false);
+    for (unsigned i = 0; i < threadCount; ++i) {
+        m_lanes.push_back(std::make_unique<Lane>(queueCapacity));
+    }
+    for (auto& lane : m_lanes) {
+        lane->thread = std::thread(&CallbackDispatcher::laneLoop, this, std::ref(*lane));
+    }
+}
+
+void CallbackDispatcher::stop() {
+    if (m_lanes.empty()) {
+        return;
+    }
+
+    m_stopping.store(true);
+    for (auto& lane : m_lanes) {
+        lane->gate.notify();
+    }
+    for (auto& lane : m_lanes) {
+        if (lane->thread.joinable()) {
+            lane->thread.join();
+        }
+    }
+    m_lanes.clear();
+}
+
+void CallbackDispatcher::dispatch(SignalInfo& signal, SignalState state, double value) {
+    m_submitted.fetch_add(1, std::memory_order_relaxed);
+    if (m_lanes.empty()) {
+        deliver(signal, state, value);
+        return;
+    }
+    
+    // 按信号地址固定选择通道，保证同一信号的回调顺序
+    const auto key = reinterpret_cast<std::uintptr_t>(&signal) / alignof(SignalInfo);
+    Lane& lane = *m_lanes[key % m_lanes.size()];
+
+    Event event{signal.shared_from_this(), state, value};
+
+    if (!lane.queue.tryPush(event)) {
+        if (m_policy == OverflowPolicy::DROP) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_blocked.fetch_add(1, std::memory_order_relaxed);
+        do {
+            lane.gate.notify();
+            std::this_thread::yield();
+        } while (!lane.queue.tryPush(event));
+    }
+    lane.gate.notify();
+}
+
+DispatchStats CallbackDispatcher::stats() const {
+    DispatchStats stats;
+    stats.submitted = m_submitted.load(std::memory_order_relaxed);
+    stats.delivered = m_delivered.load(std::memory_order_relaxed);
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    stats.blocked = m_blocked.load(std::memory_order_relaxed);
+    stats.exceptions = m_exceptions.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void CallbackDispatcher::laneLoop(Lane& lane) {
+    Event event;
+    while (true) {
+        while (lane.queue.tryPop(event)) {
+            deliver(*event.signal, event.state, event.value);
+            event.signal.reset();
+        }
+        if (m_stopping.load()) {
+            // 停止前再排空一次，保证已提交的事件全部投递
+            while (lane.queue.tryPop(event)) {
+                deliver(*event.signal, event.state, event.value);
+                event.signal.reset();
+            }
+            return;
+        }
+
+        lane.gate.wait([&] { return lane.queue.sizeApprox() > 0 || m_stopping.load(); });
+    }
+}
+
+void CallbackDispatcher::deliver(const SignalInfo& signal, SignalState state, double value) {
+    try {
+        if (state == SignalState::WARNING && signal.config.warningCallback) {
+            signal.config.warningCallback(signal.signalId, value);
+        } else if (state == SignalState::FAULT && signal.config.faultCallback) {
+            signal.config.faultCallback(signal.signalId, value);
+        }
+    } catch (const std::exception& e) {
+        m_exceptions.fetch_add(1, std::memory_order_relaxed);
+        TC_LOG_ERROR("信号 %s 的回调发生错误: %s", signal.signalId.c_str(), e.what());
+    }
+    m_delivered.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,143 @@
+#include "JournalReader.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+std::vector<JournalSegmentInfo> JournalReader::listSegments(const std::string& directory, const std::string& prefix) {
+    std::vector<JournalSegmentInfo> segments;
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+        return segments;
+    }
+
+    // 文件名形如<prefix>-<序号>.tcj
+    const std::string head = prefix + "-";
+    const std::string tail = ".tcj";
+    while (dirent* entry = readdir(dir)) {
+        const std::string name = entry->d_name;
+        if (name.size() <= head.size() + tail.size() || name.compare(0, head.size(), head) != 0 ||
+            name.compare(name.size() - tail.size(), tail.size(), tail) != 0) {
+            continue;
+        }
+        const std::string digits = name.substr(head.size(), name.size() - head.size() - tail.size());
+        if (!std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            continue;
+        }
+        segments.push_back({directory + "/" + name, std::strtoull(digits.c_str(), nullptr, 10)});
+    }
+    closedir(dir);
+
+    std::sort(segments.begin(), segments.end(),
+              [](const JournalSegmentInfo& a, const JournalSegmentInfo& b) { return a.index < b.index; });
+    return segments;
+}
+
+std::unique_ptr<JournalReader> JournalReader::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat info{};
+    void* mapping = MAP_FAILED;
+    std::size_t size = 0;
+    int error = EPROTO;
+    if (fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) >= sizeof(JournalFileHeader)) {
+        size = static_cast<std::size_t>(info.st_size);
+        mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        error = errno;
+    }
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        errno = error;
+        return nullptr;
+    }
+
+    const auto* header = static_cast<const JournalFileHeader*>(mapping);
+    if (header->magic != JournalFileHeader::kMagic || header->version != JournalFileHeader::kVersion ||
+        header->headerBytes < sizeof(JournalFileHeader) || header->headerBytes > size) {
+        munmap(mapping, size);
+        errno = EPROTO;
+        return nullptr;
+    }
+    // 顺序扫描，提示内核积极预读
+    madvise(mapping, size, MADV_SEQUENTIAL);
+    return std::unique_ptr<JournalReader>(new JournalReader(static_cast<const char*>(mapping), size));
+}
+
+JournalReader::JournalReader(const char* base, std::size_t size)
+    : m_base(base), m_size(size), m_offset(header().headerBytes) {}
+
+JournalReader::~JournalReader() {
+    munmap(const_cast<char*>(m_base), m_size);
+}
+
+bool JournalReader::next(JournalEvent& event) {
+    // 未知类型的记录按长度跳过，兼容之后新增的记录类型
+    while (true) {
+        if (m_offset + sizeof(JournalRecordHeader) > m_size) {
+            return false;
+        }
+        JournalRecordHeader header;
+        std::memcpy(&header, m_base + m_offset, sizeof(header));
+        if (header.size < sizeof(JournalRecordHeader) || (header.size & 7) != 0 || header.size > m_size - m_offset) {
+            return false;  // 数据末尾，或写入中途被截断的记录
+        }
+        const char* record = m_base + m_offset;
+
+        switch (static_cast<JournalRecordType>(header.type)) {
+            case JournalRecordType::SIGNAL: {
+                JournalSignalRecord body;
+                if (header.size < sizeof(body)) {
+                    return false;
+                }
+                std::memcpy(&body, record, sizeof(body));
+                if (body.idLength > header.size - sizeof(body)) {
+                    return false;
+                }
+                event.type = JournalRecordType::SIGNAL;
+                event.handle = body.handle;
+                event.signalId = record + sizeof(body);
+                event.signalIdLength = body.idLength;
+                break;
+            }
+            case JournalRecordType::TRANSITION: {
+                JournalTransitionRecord body;
+                if (header.size < sizeof(body)) {
+                    return false;
+                }
+                std::memcpy(&body, record, sizeof(body));
+                event.type = JournalRecordType::TRANSITION;
+                event.handle = body.handle;
+                event.timestampNs = body.timestampNs;
+                event.value = body.value;
+                event.oldState = body.oldState;
+                event.newState = body.newState;
+                break;
+            }
+            case JournalRecordType::SAMPLE: {
+                JournalSampleRecord body;
+                if (header.size < sizeof(body)) {
+                    return false;
+                }
+                std::memcpy(&body, record, sizeof(body));
+                event.type = JournalRecordType::SAMPLE;
+                event.handle = body.handle;
+                event.timestampNs = body.timestampNs;
+                event.value = body.value;
+                break;
+            }
+            default:
+                m_offset += header.size;
+                continue;
+        }
+        m_offset += header.size;
+        return true;
+    }
+}
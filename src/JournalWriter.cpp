@@ -0,0 +1,228 @@
+#include "JournalWriter.h"
+#include "JournalReader.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr std::size_t kMinSegmentBytes = 4096;
+
+std::int64_t toNs(std::chrono::steady_clock::time_point timePoint) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch()).count();
+}
+
+} // namespace
+
+std::unique_ptr<JournalWriter> JournalWriter::open(const JournalConfig& config) {
+    if (config.directory.empty() || config.prefix.empty()) {
+        errno = EINVAL;
+        return nullptr;
+    }
+    if (mkdir(config.directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        return nullptr;
+    }
+
+    std::unique_ptr<JournalWriter> writer(new JournalWriter(config));
+    // 接续目录中已有段文件的序号，已有的段也计入保留数量
+    for (const auto& segment : JournalReader::listSegments(config.directory, config.prefix)) {
+        writer->m_segments.push_back(segment.path);
+        writer->m_nextIndex = std::max(writer->m_nextIndex, segment.index + 1);
+    }
+    if (!writer->openSegment()) {
+        return nullptr;
+    }
+    return writer;
+}
+
+JournalWriter::JournalWriter(const JournalConfig& config) : m_config(config) {
+    m_config.segmentBytes = std::max(journalAlign(m_config.segmentBytes), kMinSegmentBytes);
+}
+
+JournalWriter::~JournalWriter() {
+    closeSegment();
+}
+
+bool JournalWriter::openSegment(std::size_t reserveBytes) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "-%08llu.tcj", static_cast<unsigned long long>(m_nextIndex));
+    const std::string path = m_config.directory + "/" + m_config.prefix + name;
+
+    int fd = ::open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    // 预分配整个段，写入时不再扩展文件
+    int error = posix_fallocate(fd, 0, static_cast<off_t>(m_config.segmentBytes));
+    if (error == EOPNOTSUPP || error == EINVAL) {
+        error = ftruncate(fd, static_cast<off_t>(m_config.segmentBytes)) == 0 ? 0 : errno;
+    }
+    void* mapping = MAP_FAILED;
+    if (error == 0) {
+        mapping = mmap(nullptr, m_config.segmentBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        error = mapping == MAP_FAILED ? errno : 0;
+    }
+    if (mapping == MAP_FAILED) {
+        ::close(fd);
+        ::unlink(path.c_str());
+        errno = error;
+        return false;
+    }
+
+    m_fd = fd;
+    m_base = static_cast<char*>(mapping);
+    JournalFileHeader header{};
+    header.magic = JournalFileHeader::kMagic;
+    header.version = JournalFileHeader::kVersion;
+    header.headerBytes = sizeof(JournalFileHeader);
+    header.segmentIndex = m_nextIndex;
+    header.steadyOriginNs = toNs(std::chrono::steady_clock::now());
+    header.wallOriginNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::memcpy(m_base, &header, sizeof(header));
+    m_offset = sizeof(JournalFileHeader);
+    ++m_nextIndex;
+    // 段文件开头写入现存信号：最多占半个段，并为触发轮转的记录与结束标记留出空间，
+    // 放不下的部分（段过小）在读取时显示为未知信号
+    const std::size_t tableEnd = m_config.segmentBytes -
+        std::max(reserveBytes + sizeof(JournalRecordHeader), m_config.segmentBytes / 2);
+    for (const auto& [handle, signalId] : m_signals) {
+        const std::size_t bytes = journalAlign(sizeof(JournalSignalRecord) + signalId.size());
+        if (m_offset + bytes > tableEnd) {
+            break;
+        }
+        writeSignal(m_base + m_offset, bytes, handle, signalId);
+    }
+    m_created.fetch_add(1, std::memory_order_relaxed);
+
+    m_segments.push_back(path);
+    while (m_config.maxSegments > 0 && m_segments.size() > m_config.maxSegments) {
+        ::unlink(m_segments.front().c_str());
+        m_segments.pop_front();
+    }
+    return true;
+}
+
+void JournalWriter::closeSegment() {
+    if (!m_base) {
+        return;
+    }
+    munmap(m_base, m_config.segmentBytes);
+    // 截断未使用的预分配空间；写满轮转的段保留末尾的0作为数据结束标记
+    if (ftruncate(m_fd, static_cast<off_t>(std::min(m_offset + sizeof(JournalRecordHeader),
+                                                    m_config.segmentBytes))) != 0) {
+        TC_LOG_WARN("截断日志段文件失败: %s", std::strerror(errno));
+    }
+    ::close(m_fd);
+    m_base = nullptr;
+    m_fd = -1;
+}
+
+char* JournalWriter::reserve(std::size_t bytes) {
+    if (m_failed) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    // 段末尾至少留出一个记录头的0作为结束标记
+    if (m_offset + bytes + sizeof(JournalRecordHeader) > m_config.segmentBytes) {
+        if (bytes + sizeof(JournalFileHeader) + sizeof(JournalRecordHeader) > m_config.segmentBytes) {
+            // 单条记录（过长的信号ID）超过段大小，只丢弃该记录
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        closeSegment();
+        if (!openSegment(bytes)) {
+            TC_LOG_ERROR("创建日志段文件失败，停止写入日志: %s", std::strerror(errno));
+            m_failed = true;
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        if (m_offset + bytes + sizeof(JournalRecordHeader) > m_config.segmentBytes) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+    return m_base + m_offset;
+}
+
+void JournalWriter::commit(char* record, JournalRecordType type, std::size_t bytes) {
+    // 记录头最后写入：进程在写入中途退出时，读者在未完成的记录处停止
+    JournalRecordHeader header{static_cast<std::uint32_t>(bytes), static_cast<std::uint16_t>(type), 0};
+    std::memcpy(record, &header, sizeof(header));
+    m_offset += bytes;
+    m_records.fetch_add(1, std::memory_order_relaxed);
+    m_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void JournalWriter::appendSignal(std::uint64_t handle, const std::string& signalId) {
+    m_signals[handle] = signalId;
+    const std::size_t bytes = journalAlign(sizeof(JournalSignalRecord) + signalId.size());
+    char* record = reserve(bytes);
+    if (!record) {
+        return;
+    }
+    writeSignal(record, bytes, handle, signalId);
+}
+
+void JournalWriter::forgetSignal(std::uint64_t handle) {
+    m_signals.erase(handle);
+}
+
+void JournalWriter::writeSignal(char* record, std::size_t bytes, std::uint64_t handle, const std::string& signalId) {
+    JournalSignalRecord body{};
+    body.handle = handle;
+    body.idLength = static_cast<std::uint32_t>(signalId.size());
+    std::memcpy(record + sizeof(JournalRecordHeader), reinterpret_cast<const char*>(&body) + sizeof(JournalRecordHeader),
+                sizeof(body) - sizeof(JournalRecordHeader));
+    std::memcpy(record + sizeof(body), signalId.data(), signalId.size());
+    std::memset(record + sizeof(body) + signalId.size(), 0, bytes - sizeof(body) - signalId.size());
+    commit(record, JournalRecordType::SIGNAL, bytes);
+}
+
+void JournalWriter::appendTransition(std::uint64_t handle, std::uint8_t oldState, std::uint8_t newState,
+                                     double value, std::chrono::steady_clock::time_point timestamp) {
+    char* record = reserve(sizeof(JournalTransitionRecord));
+    if (!record) {
+        return;
+    }
+    JournalTransitionRecord body{};
+    body.oldState = oldState;
+    body.newState = newState;
+    body.handle = handle;
+    body.timestampNs = toNs(timestamp);
+    body.value = value;
+    std::memcpy(record + sizeof(JournalRecordHeader), reinterpret_cast<const char*>(&body) + sizeof(JournalRecordHeader),
+                sizeof(body) - sizeof(JournalRecordHeader));
+    commit(record, JournalRecordType::TRANSITION, sizeof(body));
+}
+
+void JournalWriter::appendSample(std::uint64_t handle, double value, std::chrono::steady_clock::time_point timestamp) {
+    char* record = reserve(sizeof(JournalSampleRecord));
+    if (!record) {
+        return;
+    }
+    JournalSampleRecord body{};
+    body.handle = handle;
+    body.timestampNs = toNs(timestamp);
+    body.value = value;
+    std::memcpy(record + sizeof(JournalRecordHeader), reinterpret_cast<const char*>(&body) + sizeof(JournalRecordHeader),
+                sizeof(body) - sizeof(JournalRecordHeader));
+    commit(record, JournalRecordType::SAMPLE, sizeof(body));
+}
+
+JournalStats JournalWriter::stats() const {
+    JournalStats stats;
+    stats.enabled = true;
+    stats.records = m_records.load(std::memory_order_relaxed);
+    stats.bytes = m_bytes.load(std::memory_order_relaxed);
+    stats.segments = m_created.load(std::memory_order_relaxed);
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,122 @@
+#include "Logger.h"
+#include <cstdarg>
+#include <cstdio>
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger() {
+    m_writer = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger() {
+    m_stopping.store(true);
+    m_gate.notify();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+}
+
+void Logger::setLevel(LogLevel level) {
+    m_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+LogLevel Logger::level() const {
+    return static_cast<LogLevel>(m_level.load(std::memory_order_relaxed));
+}
+
+void Logger::setSink(LogSink sink) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sink = std::move(sink);
+}
+
+void Logger::log(LogLevel level, const char* format, ...) {
+    LogRecord record;
+    record.level = level;
+    record.time = std::chrono::system_clock::now();
+
+    va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(record.text, sizeof(record.text), format, args);
+    va_end(args);
+    if (length < 0) {
+        return;
+    }
+    record.length = static_cast<std::uint32_t>(
+        static_cast<std::size_t>(length) < LogRecord::kMaxLength ? length : LogRecord::kMaxLength);
+
+    if (!m_queue.tryPush(record)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    m_submitted.fetch_add(1, std::memory_order_release);
+    m_gate.notify();
+}
+
+void Logger::flush() {
+    const std::uint64_t target = m_submitted.load(std::memory_order_acquire);
+    m_gate.notify();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_drained.wait(lock, [&] {
+        return m_written.load(std::memory_order_acquire) >= target || m_stopping.load();
+    });
+}
+
+std::uint64_t Logger::dropped() const {
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+void Logger::writerLoop() {
+    // 输出目标抛出的异常不能结束写线程，否则flush()将一直等待
+    auto writeRecord = [this](const LogRecord& record) {
+        try {
+            write(record);
+        } catch (...) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_written.fetch_add(1, std::memory_order_release);
+    };
+
+    LogRecord record;
+    while (true) {
+        bool wrote = false;
+        while (m_queue.tryPop(record)) {
+            writeRecord(record);
+            wrote = true;
+        }
+        if (wrote) {
+            std::fflush(stdout);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_drained.notify_all();
+        }
+        if (m_stopping.load()) {
+            // 停止前再排空一次，保证已提交的日志全部写出
+            while (m_queue.tryPop(record)) {
+                writeRecord(record);
+            }
+            std::fflush(stdout);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_drained.notify_all();
+            return;
+        }
+
+        m_gate.wait([this] { return m_queue.sizeApprox() > 0 || m_stopping.load(); });
+    }
+}
+
+void Logger::write(const LogRecord& record) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_sink) {
+            m_sink(record);
+            return;
+        }
+    }
+
+    std::FILE* stream = record.level >= LogLevel::WARN ? stderr : stdout;
+    std::fwrite(record.text, 1, record.length, stream);
+    std::fputc('\n', stream);
+}
@@ -0,0 +1,137 @@
+#include "RealtimeThread.h"
+#include "ThreadAffinity.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <alloca.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::size_t kMaxPrefaultStackBytes = 4u << 20;
+
+#if defined(__linux__)
+int toNativePolicy(SchedulingPolicy policy) {
+    switch (policy) {
+        case SchedulingPolicy::FIFO: return SCHED_FIFO;
+        case SchedulingPolicy::RR: return SCHED_RR;
+        default: return SCHED_OTHER;
+    }
+}
+
+SchedulingPolicy fromNativePolicy(int policy) {
+    switch (policy) {
+        case SCHED_FIFO: return SchedulingPolicy::FIFO;
+        case SCHED_RR: return SchedulingPolicy::RR;
+        default: return SchedulingPolicy::OTHER;
+    }
+}
+
+// 逐页写入栈上的一段空间，使其在实时路径上不再触发缺页；不内联以保证空间确实在栈上分配
+__attribute__((noinline)) std::size_t prefaultStack(std::size_t bytes) {
+    const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    volatile char* stack = static_cast<volatile char*>(alloca(bytes));
+    for (std::size_t offset = 0; offset < bytes; offset += page) {
+        stack[offset] = 0;
+    }
+    return bytes;
+}
+#endif
+
+const char* policyName(SchedulingPolicy policy) {
+    switch (policy) {
+        case SchedulingPolicy::FIFO: return "FIFO";
+        case SchedulingPolicy::RR: return "RR";
+        default: return "OTHER";
+    }
+}
+
+} // namespace
+
+int setThreadScheduling(std::thread::native_handle_type thread, SchedulingPolicy policy, int priority) {
+#if defined(__linux__)
+    sched_param param{};
+    param.sched_priority = policy == SchedulingPolicy::OTHER ? 0 : priority;
+    return pthread_setschedparam(thread, toNativePolicy(policy), &param);
+#else
+    (void)thread;
+    (void)policy;
+    (void)priority;
+    return ENOSYS;
+#endif
+}
+
+RealtimeReport applyRealtimeConfig(const RealtimeConfig& config) {
+    RealtimeReport report;
+    report.applied = true;
+#if defined(__linux__)
+    // 先锁定内存再预取栈，预取的页面随即常驻
+    if (config.lockMemory) {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) {
+            report.memoryLocked = true;
+        } else {
+            report.memoryLockError = errno;
+        }
+    }
+    if (config.prefaultStackBytes > 0) {
+        report.stackPrefaulted = prefaultStack(std::min(config.prefaultStackBytes, kMaxPrefaultStackBytes));
+    }
+
+    report.schedulingError = setThreadScheduling(pthread_self(), config.policy, config.priority);
+    if (!config.cpus.empty() && !setCurrentThreadAffinity(config.cpus)) {
+        report.affinityError = errno != 0 ? errno : EINVAL;
+    }
+
+    // 从内核读回实际生效的值
+    int nativePolicy = SCHED_OTHER;
+    sched_param param{};
+    if (pthread_getschedparam(pthread_self(), &nativePolicy, &param) == 0) {
+        report.policy = fromNativePolicy(nativePolicy);
+        report.priority = param.sched_priority;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+        for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                report.cpus.push_back(cpu);
+            }
+        }
+    }
+#else
+    report.schedulingError = ENOSYS;
+    report.affinityError = config.cpus.empty() ? 0 : ENOSYS;
+    report.memoryLockError = config.lockMemory ? ENOSYS : 0;
+#endif
+    return report;
+}
+
+std::string describeRealtimeReport(const RealtimeReport& report) {
+    std::string text = "调度 ";
+    text += policyName(report.policy);
+    text += "/" + std::to_string(report.priority);
+    if (report.schedulingError != 0) {
+        text += std::string("（设置失败: ") + std::strerror(report.schedulingError) + "）";
+    }
+
+    text += "，CPU ";
+    for (std::size_t i = 0; i < report.cpus.size(); ++i) {
+        text += (i > 0 ? "," : "") + std::to_string(report.cpus[i]);
+    }
+    if (report.affinityError != 0) {
+        text += std::string("（设置失败: ") + std::strerror(report.affinityError) + "）";
+    }
+
+    text += report.memoryLocked ? "，内存已锁定" : "，内存未锁定";
+    if (report.memoryLockError != 0) {
+        text += std::string("（mlockall失败: ") + std::strerror(report.memoryLockError) + "）";
+    }
+    text += "，栈预取 " + std::to_string(report.stackPrefaulted / 1024) + "KB";
+    return text;
+}
@@ -0,0 +1,137 @@
+#include "ReplayEngine.h"
+#include "JournalReader.h"
+#include "Logger.h"
+#include <algorithm>
+#include <unordered_map>
+
+std::unique_ptr<ReplayEngine> ReplayEngine::create(ToleranceChecker& checker) {
+    auto clock = std::dynamic_pointer_cast<VirtualClock>(checker.clock());
+    if (!clock) {
+        TC_LOG_ERROR("回放要求监控器使用虚拟时钟");
+        return nullptr;
+    }
+    if (checker.isMonitoring()) {
+        TC_LOG_ERROR("回放要求监控器不启动后台监控线程");
+        return nullptr;
+    }
+    return std::unique_ptr<ReplayEngine>(new ReplayEngine(checker, std::move(clock)));
+}
+
+ReplayEngine::ReplayEngine(ToleranceChecker& checker, std::shared_ptr<VirtualClock> clock)
+    : m_checker(checker), m_clock(std::move(clock)) {
+    m_checker.setReplayMode(true);
+}
+
+ReplayEngine::~ReplayEngine() {
+    m_checker.setReplayMode(false);
+}
+
+void ReplayEngine::feed(const ReplaySample* samples, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        push(samples[i]);
+    }
+    flush();
+}
+
+bool ReplayEngine::feedJournal(const std::string& directory, const std::string& prefix) {
+    const auto segments = JournalReader::listSegments(directory, prefix);
+    if (segments.empty()) {
+        return false;
+    }
+
+    // 日志句柄 -> 本监控器中的句柄，每个段文件开头都会重新写入信号记录
+    std::unordered_map<std::uint64_t, SignalHandle> handles;
+    bool opened = false;
+    for (const auto& segment : segments) {
+        auto reader = JournalReader::open(segment.path);
+        if (!reader) {
+            TC_LOG_WARN("无法读取日志段文件 %s", segment.path.c_str());
+            continue;
+        }
+        opened = true;
+        JournalEvent event;
+        while (reader->next(event)) {
+            if (event.type == JournalRecordType::SIGNAL) {
+                handles[event.handle] = m_checker.findSignal(std::string(event.signalId, event.signalIdLength));
+            } else if (event.type == JournalRecordType::SAMPLE) {
+                auto found = handles.find(event.handle);
+                if (found == handles.end() || !found->second) {
+                    ++m_stats.unknown;
+                    continue;
+                }
+                push(ReplaySample{std::chrono::steady_clock::time_point(std::chrono::nanoseconds(event.timestampNs)),
+                                  found->second, event.value});
+            }
+        }
+    }
+    flush();
+    return opened;
+}
+
+void ReplayEngine::push(const ReplaySample& sample) {
+    auto timestamp = sample.timestamp;
+    const auto now = m_clock->now();
+    if (timestamp < now) {
+        // 时钟不能后退（如按分片写入日志造成的微小乱序），按当前时间处理
+        ++m_stats.late;
+        timestamp = now;
+    } else if (timestamp > now) {
+        advanceTo(timestamp);
+    }
+
+    // 推送只保留每个信号的最新样本：同一信号在本批已有样本时先评估本批
+    const std::uint32_t slot = sample.handle.index;
+    if (slot < m_batchMarks.size() && m_batchMarks[slot] == m_batch) {
+        flush();
+    }
+    if (!m_checker.pushValue(sample.handle, sample.value, timestamp, PushMode::IMMEDIATE)) {
+        ++m_stats.unknown;
+        return;
+    }
+    if (slot >= m_batchMarks.size()) {
+        m_batchMarks.resize(std::max<std::size_t>(slot + 1, m_batchMarks.size() * 2), 0);
+    }
+    m_batchMarks[slot] = m_batch;
+    m_pending = true;
+    ++m_stats.samples;
+}
+
+void ReplayEngine::advanceTo(std::chrono::steady_clock::time_point target) {
+    flush();
+    for (auto due = m_checker.nextDueTime(); due <= target; due = m_checker.nextDueTime()) {
+        m_clock->set(due);
+        runPass();
+    }
+    m_clock->set(target);
+}
+
+void ReplayEngine::flush() {
+    if (!m_pending) {
+        return;
+    }
+    runPass();
+    m_pending = false;
+    if (++m_batch == 0) {
+        std::fill(m_batchMarks.begin(), m_batchMarks.end(), 0);
+        m_batch = 1;
+    }
+}
+
+void ReplayEngine::runPass() {
+    m_checker.runOnce();
+    ++m_stats.passes;
+}
+
+std::chrono::steady_clock::time_point ReplayEngine::journalStartTime(const std::string& directory,
+                                                                     const std::string& prefix) {
+    for (const auto& segment : JournalReader::listSegments(directory, prefix)) {
+        auto reader = JournalReader::open(segment.path);
+        JournalEvent event;
+        while (reader && reader->next(event)) {
+            if (event.type != JournalRecordType::SIGNAL) {
+                return std::chrono::steady_clock::time_point(std::chrono::nanoseconds(event.timestampNs));
+            }
+        }
+    }
+    return std::chrono::steady_clock::time_point{};
+}
@@ -0,0 +1,77 @@
+#include "SampleHistory.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace {
+
+constexpr std::size_t kCacheLine = 64;
+
+std::size_t storageBytes(std::size_t capacity) {
+    const std::size_t bytes = capacity * sizeof(HistorySample);
+    return (bytes + kCacheLine - 1) / kCacheLine * kCacheLine;
+}
+
+} // namespace
+
+bool SampleHistoryView::intact() const {
+    return !owner || owner->retains(oldestSequence);
+}
+
+void SampleHistory::AlignedDelete::operator()(HistorySample* samples) const {
+    ::operator delete(samples, std::align_val_t(kCacheLine));
+}
+
+SampleHistory::SampleHistory(std::size_t capacity)
+    : m_capacity(std::max<std::size_t>(capacity, 1)) {
+    auto* storage = static_cast<HistorySample*>(
+        ::operator new(storageBytes(m_capacity), std::align_val_t(kCacheLine)));
+    // 逐个初始化同时写入了每一页，检查线程首次写入时不会触发缺页
+    std::uninitialized_value_construct_n(storage, m_capacity);
+    m_samples.reset(storage);
+}
+
+std::size_t SampleHistory::footprint(std::size_t capacity) {
+    return sizeof(SampleHistory) + storageBytes(std::max<std::size_t>(capacity, 1));
+}
+
+SampleHistoryView SampleHistory::view(const std::shared_ptr<const SampleHistory>& self) {
+    SampleHistoryView view;
+    if (!self) {
+        return view;
+    }
+    const std::uint64_t written = self->written();
+    const std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(written, self->m_capacity));
+    const std::uint64_t oldest = written - count;
+    const std::size_t start = static_cast<std::size_t>(oldest % self->m_capacity);
+
+    view.first = &self->m_samples[start];
+    view.firstCount = std::min(count, self->m_capacity - start);
+    view.second = &self->m_samples[0];
+    view.secondCount = count - view.firstCount;
+    view.oldestSequence = oldest;
+    view.owner = self;
+    return view;
+}
+
+std::size_t SampleHistory::copy(HistorySample* out, std::size_t capacity) const {
+    const std::uint64_t written = m_written.load(std::memory_order_acquire);
+    const std::size_t count = static_cast<std::size_t>(
+        std::min<std::uint64_t>({written, static_cast<std::uint64_t>(m_capacity), static_cast<std::uint64_t>(capacity)}));
+    const std::uint64_t oldest = written - count;
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = m_samples[(oldest + i) % m_capacity];
+    }
+
+    // 复制期间被写者覆盖（含正在覆盖）的最旧样本不可信，将其剔除
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t claimed = m_claimed.load(std::memory_order_relaxed);
+    const std::uint64_t firstValid = claimed > m_capacity ? claimed - m_capacity : 0;
+    if (firstValid <= oldest) {
+        return count;
+    }
+    const std::size_t torn = static_cast<std::size_t>(std::min<std::uint64_t>(firstValid - oldest, count));
+    std::memmove(out, out + torn, (count - torn) * sizeof(HistorySample));
+    return count - torn;
+}
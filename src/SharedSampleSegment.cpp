@@ -0,0 +1,148 @@
+#include "SharedSampleSegment.h"
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// 读者与写者冲突时的重试次数上限
+constexpr int kReadRetries = 8;
+
+} // namespace
+
+std::size_t SharedSampleSegment::mappingSize(std::uint32_t slotCount) {
+    return sizeof(SharedSampleHeader) + static_cast<std::size_t>(slotCount) * sizeof(SharedSampleSlot);
+}
+
+SharedSampleSegment::SharedSampleSegment(std::string name, void* mapping, std::size_t size)
+    : m_name(std::move(name)), m_mapping(mapping), m_size(size) {
+    auto* header = static_cast<SharedSampleHeader*>(mapping);
+    m_slotCount = header->slotCount;
+    m_slots = reinterpret_cast<SharedSampleSlot*>(static_cast<char*>(mapping) + sizeof(SharedSampleHeader));
+}
+
+SharedSampleSegment::~SharedSampleSegment() {
+    if (m_mapping) {
+        munmap(m_mapping, m_size);
+    }
+}
+
+std::shared_ptr<SharedSampleSegment> SharedSampleSegment::create(const std::string& name, std::uint32_t slotCount) {
+    if (slotCount == 0) {
+        errno = EINVAL;
+        return nullptr;
+    }
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+    if (fd < 0) {
+        return nullptr;
+    }
+    const std::size_t size = mappingSize(slotCount);
+    void* mapping = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+        mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    const int error = errno;
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        errno = error;
+        return nullptr;
+    }
+
+    // ftruncate得到的内存已清零：所有槽位均为"从未写入"，最后写入魔数发布头部
+    auto* header = static_cast<SharedSampleHeader*>(mapping);
+    header->version = kVersion;
+    header->slotCount = slotCount;
+    header->magic.store(kMagic, std::memory_order_release);
+    return std::shared_ptr<SharedSampleSegment>(new SharedSampleSegment(name, mapping, size));
+}
+
+std::shared_ptr<SharedSampleSegment> SharedSampleSegment::open(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    // 先映射头部校验布局，再按槽位数量映射整个段
+    struct stat info{};
+    void* mapping = MAP_FAILED;
+    std::size_t size = 0;
+    int error = EPROTO;
+    if (fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) >= sizeof(SharedSampleHeader)) {
+        void* headerMapping = mmap(nullptr, sizeof(SharedSampleHeader), PROT_READ, MAP_SHARED, fd, 0);
+        if (headerMapping != MAP_FAILED) {
+            const auto* header = static_cast<const SharedSampleHeader*>(headerMapping);
+            if (header->magic.load(std::memory_order_acquire) == kMagic && header->version == kVersion &&
+                header->slotCount > 0 && mappingSize(header->slotCount) <= static_cast<std::size_t>(info.st_size)) {
+                size = mappingSize(header->slotCount);
+            }
+            munmap(headerMapping, sizeof(SharedSampleHeader));
+        }
+        if (size > 0) {
+            mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            error = errno;
+        }
+    } else {
+        error = errno != 0 ? errno : EPROTO;
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        errno = error;
+        return nullptr;
+    }
+    return std::shared_ptr<SharedSampleSegment>(new SharedSampleSegment(name, mapping, size));
+}
+
+bool SharedSampleSegment::unlink(const std::string& name) {
+    return shm_unlink(name.c_str()) == 0;
+}
+
+bool SharedSampleSegment::publish(std::uint32_t slot, double value, std::chrono::steady_clock::time_point timestamp) {
+    if (slot >= m_slotCount) {
+        return false;
+    }
+    SharedSampleSlot& target = m_slots[slot];
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint64_t sequence = target.sequence.load(std::memory_order_relaxed);
+    // 上一个写者中途退出时序号停在奇数，跳到下一个奇数继续
+    const std::uint64_t writing = (sequence | 1) + ((sequence & 1) ? 2 : 0);
+    target.sequence.store(writing, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    target.valueBits.store(bits, std::memory_order_relaxed);
+    target.timestamp.store(timestamp.time_since_epoch().count(), std::memory_order_relaxed);
+    target.sequence.store(writing + 1, std::memory_order_release);
+    return true;
+}
+
+bool SharedSampleSegment::read(std::uint32_t slot, SharedSample& sample) const {
+    if (slot >= m_slotCount) {
+        return false;
+    }
+    const SharedSampleSlot& source = m_slots[slot];
+    for (int attempt = 0; attempt < kReadRetries; ++attempt) {
+        const std::uint64_t before = source.sequence.load(std::memory_order_acquire);
+        if (before == 0) {
+            return false;
+        }
+        if (before & 1) {
+            continue;
+        }
+        const std::uint64_t bits = source.valueBits.load(std::memory_order_relaxed);
+        const std::int64_t timestamp = source.timestamp.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (source.sequence.load(std::memory_order_relaxed) == before) {
+            std::memcpy(&sample.value, &bits, sizeof(bits));
+            sample.timestamp = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(timestamp));
+            sample.sequence = before;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,69 @@
+#include "SharedSampleSegment_c.h"
+#include <chrono>
+#include <exception>
+#include <new>
+
+tc_shm_segment_t* tc_shm_create(const char* name, unsigned slot_count) {
+    if (!name) {
+        return nullptr;
+    }
+    
+    try {
+        auto cpp_segment = SharedSampleSegment::create(name, slot_count);
+        if (!cpp_segment) {
+            return nullptr;
+        }
+        return new tc_shm_segment{std::move(cpp_segment)};
+        
+    } catch (const std::exception& e) {
+        return nullptr;
+    }
+}
+
+tc_shm_segment_t* tc_shm_open(const char* name) {
+    if (!name) {
+        return nullptr;
+    }
+    
+    try {
+        auto cpp_segment = SharedSampleSegment::open(name);
+        if (!cpp_segment) {
+            return nullptr;
+        }
+        return new tc_shm_segment{std::move(cpp_segment)};
+        
+    } catch (const std::exception& e) {
+        return nullptr;
+    }
+}
+
+void tc_shm_close(tc_shm_segment_t* segment) {
+    delete segment;
+}
+
+int tc_shm_unlink(const char* name) {
+    if (!name) {
+        return -1;
+    }
+    return SharedSampleSegment::unlink(name) ? 0 : -1;
+}
+
+unsigned tc_shm_slot_count(const tc_shm_segment_t* segment) {
+    return segment ? segment->segment->slotCount() : 0;
+}
+
+int tc_shm_publish(tc_shm_segment_t* segment, unsigned slot, double value) {
+    if (!segment) {
+        return -1;
+    }
+    return segment->segment->publish(slot, value) ? 0 : -1;
+}
+
+int tc_shm_publish_at(tc_shm_segment_t* segment, unsigned slot, double value, long long timestamp_ns) {
+    if (!segment) {
+        return -1;
+    }
+    auto timestamp = std::chrono::steady_clock::time_point(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(timestamp_ns)));
+    return segment->segment->publish(slot, value, timestamp) ? 0 : -1;
+}
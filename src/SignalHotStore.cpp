@@ -0,0 +1,188 @@
+#include "SignalHotStore.h"
+#include <cmath>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TC_HOTSTORE_X86 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define TC_HOTSTORE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+constexpr std::uint8_t kNormal = 1;   // SignalState::NORMAL
+constexpr std::uint8_t kWarning = 2;  // SignalState::WARNING
+constexpr std::uint8_t kFault = 3;    // SignalState::FAULT
+
+inline std::uint8_t classifyOne(double value, double target, double warning, double fault) {
+    const double deviation = std::abs(value - target);
+    if (deviation <= warning) {
+        return kNormal;
+    }
+    return deviation <= fault ? kWarning : kFault;
+}
+
+void classifyScalar(const double* values, const double* targets, const double* warnings,
+                    const double* faults, std::uint8_t* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = classifyOne(values[i], targets[i], warnings[i], faults[i]);
+    }
+}
+
+void classifyIndexedScalar(const std::uint32_t* slots, std::size_t count, const double* values,
+                           const double* targets, const double* warnings, const double* faults,
+                           std::uint8_t* out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint32_t s = slots[i];
+        out[i] = classifyOne(values[s], targets[s], warnings[s], faults[s]);
+    }
+}
+
+#if defined(TC_HOTSTORE_X86)
+
+// 偏差<=警告阈值取NORMAL，否则按是否<=故障阈值取WARNING/FAULT；有序比较使NaN落入FAULT
+__attribute__((target("avx2"))) inline __m128i bandsAvx2(__m256d value, __m256d target,
+                                                         __m256d warning, __m256d fault) {
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    const __m256d deviation = _mm256_andnot_pd(signMask, _mm256_sub_pd(value, target));
+    const __m256i inWarning = _mm256_castpd_si256(_mm256_cmp_pd(deviation, warning, _CMP_LE_OQ));
+    const __m256i inFault = _mm256_castpd_si256(_mm256_cmp_pd(deviation, fault, _CMP_LE_OQ));
+    // 比较结果为全1（即-1）或全0：FAULT + (-1) = WARNING
+    __m256i band = _mm256_add_epi64(_mm256_set1_epi64x(kFault), inFault);
+    band = _mm256_blendv_epi8(band, _mm256_set1_epi64x(kNormal), inWarning);
+    // 取每个64位结果的低32位，压缩到低128位
+    const __m256i packed = _mm256_permutevar8x32_epi32(band, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+    return _mm256_castsi256_si128(packed);
+}
+
+__attribute__((target("avx2"))) inline void storeBands(std::uint8_t* out, __m128i bands32) {
+    const __m128i bytes = _mm_shuffle_epi8(bands32, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1,
+                                                                  -1, -1, -1, -1, -1, -1, -1, -1));
+    const int word = _mm_cvtsi128_si32(bytes);
+    __builtin_memcpy(out, &word, 4);
+}
+
+__attribute__((target("avx2"))) inline __m256d gatherAvx2(const double* base, __m128i index) {
+    const __m256d allLanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, index, allLanes, 8);
+}
+
+__attribute__((target("avx2"))) void classifyAvx2(const double* values, const double* targets,
+                                                  const double* warnings, const double* faults,
+                                                  std::uint8_t* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        storeBands(out + i, bandsAvx2(_mm256_loadu_pd(values + i), _mm256_loadu_pd(targets + i),
+                                      _mm256_loadu_pd(warnings + i), _mm256_loadu_pd(faults + i)));
+    }
+    classifyScalar(values + i, targets + i, warnings + i, faults + i, out + i, count - i);
+}
+
+__attribute__((target("avx2"))) void classifyIndexedAvx2(const std::uint32_t* slots, std::size_t count,
+                                                         const double* values, const double* targets,
+                                                         const double* warnings, const double* faults,
+                                                         std::uint8_t* out) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(slots + i));
+        storeBands(out + i, bandsAvx2(gatherAvx2(values, index), gatherAvx2(targets, index),
+                                      gatherAvx2(warnings, index), gatherAvx2(faults, index)));
+    }
+    classifyIndexedScalar(slots + i, count - i, values, targets, warnings, faults, out + i);
+}
+
+bool hasAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#elif defined(TC_HOTSTORE_NEON)
+
+inline uint32x2_t bandsNeon(float64x2_t value, float64x2_t target, float64x2_t warning, float64x2_t fault) {
+    const float64x2_t deviation = vabdq_f64(value, target);
+    const uint64x2_t inWarning = vcleq_f64(deviation, warning);
+    const uint64x2_t inFault = vcleq_f64(deviation, fault);
+    uint64x2_t band = vsubq_u64(vdupq_n_u64(kFault), vshrq_n_u64(inFault, 63));
+    band = vbslq_u64(inWarning, vdupq_n_u64(kNormal), band);
+    return vmovn_u64(band);
+}
+
+void classifyNeon(const double* values, const double* targets, const double* warnings,
+                  const double* faults, std::uint8_t* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const uint32x2_t bands = bandsNeon(vld1q_f64(values + i), vld1q_f64(targets + i),
+                                           vld1q_f64(warnings + i), vld1q_f64(faults + i));
+        out[i] = static_cast<std::uint8_t>(vget_lane_u32(bands, 0));
+        out[i + 1] = static_cast<std::uint8_t>(vget_lane_u32(bands, 1));
+    }
+    classifyScalar(values + i, targets + i, warnings + i, faults + i, out + i, count - i);
+}
+
+#endif
+
+} // namespace
+
+void SignalHotStore::reserveSlots(std::size_t slotCount) {
+    if (slotCount <= m_targets.size()) {
+        return;
+    }
+    m_targets.resize(slotCount, 0.0);
+    m_warningThresholds.resize(slotCount, 0.0);
+    m_faultThresholds.resize(slotCount, 0.0);
+    m_lastValues.resize(slotCount, 0.0);
+    m_states.resize(slotCount, 0);
+}
+
+void SignalHotStore::setThresholds(std::uint32_t slot, double target, double warningThreshold,
+                                   double faultThreshold) {
+    reserveSlots(static_cast<std::size_t>(slot) + 1);
+    m_targets[slot] = target;
+    m_warningThresholds[slot] = warningThreshold;
+    m_faultThresholds[slot] = faultThreshold;
+    m_lastValues[slot] = target;
+    m_states[slot] = 0;
+}
+
+void SignalHotStore::classify(const std::uint32_t* slots, std::size_t count, std::uint8_t* out) const {
+#if defined(TC_HOTSTORE_X86)
+    if (hasAvx2()) {
+        classifyIndexedAvx2(slots, count, m_lastValues.data(), m_targets.data(),
+                            m_warningThresholds.data(), m_faultThresholds.data(), out);
+        return;
+    }
+#endif
+    classifyIndexedScalar(slots, count, m_lastValues.data(), m_targets.data(),
+                          m_warningThresholds.data(), m_faultThresholds.data(), out);
+}
+
+void SignalHotStore::classifyAll(std::uint8_t* out) const {
+    classifyContiguous(m_lastValues.data(), m_targets.data(), m_warningThresholds.data(),
+                       m_faultThresholds.data(), out, m_targets.size());
+}
+
+void SignalHotStore::classifyContiguous(const double* values, const double* targets,
+                                        const double* warningThresholds, const double* faultThresholds,
+                                        std::uint8_t* out, std::size_t count) {
+#if defined(TC_HOTSTORE_X86)
+    if (hasAvx2()) {
+        classifyAvx2(values, targets, warningThresholds, faultThresholds, out, count);
+        return;
+    }
+#elif defined(TC_HOTSTORE_NEON)
+    classifyNeon(values, targets, warningThresholds, faultThresholds, out, count);
+    return;
+#endif
+    classifyScalar(values, targets, warningThresholds, faultThresholds, out, count);
+}
+
+const char* SignalHotStore::kernelName() {
+#if defined(TC_HOTSTORE_X86)
+    return hasAvx2() ? "avx2" : "scalar";
+#elif defined(TC_HOTSTORE_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
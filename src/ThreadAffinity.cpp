@@ -0,0 +1,40 @@
+#include "ThreadAffinity.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+bool setThreadAffinity(std::thread::native_handle_type thread, const std::vector<unsigned>& cpus) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (cpus.empty()) {
+        const unsigned count = std::thread::hardware_concurrency();
+        for (unsigned cpu = 0; cpu < count && cpu < CPU_SETSIZE; ++cpu) {
+            CPU_SET(cpu, &set);
+        }
+    } else {
+        for (unsigned cpu : cpus) {
+            if (cpu >= CPU_SETSIZE) {
+                return false;
+            }
+            CPU_SET(cpu, &set);
+        }
+    }
+    return pthread_setaffinity_np(thread, sizeof(set), &set) == 0;
+#else
+    (void)thread;
+    (void)cpus;
+    return false;
+#endif
+}
+
+bool setCurrentThreadAffinity(const std::vector<unsigned>& cpus) {
+#if defined(__linux__)
+    return setThreadAffinity(pthread_self(), cpus);
+#else
+    (void)cpus;
+    return false;
+#endif
+}
@@ -0,0 +1,193 @@
+#include "TimerWheel.h"
+
+namespace {
+
+// 64位循环右移
+inline std::uint64_t rotateRight(std::uint64_t bits, unsigned shift) {
+    shift &= 63u;
+    return shift == 0 ? bits : (bits >> shift) | (bits << (64u - shift));
+}
+
+// 最低置位的位置，bits 不能为0
+inline unsigned lowestSetBit(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+    unsigned index = 0;
+    while ((bits & 1u) == 0) {
+        bits >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+} // namespace
+
+TimerWheel::TimerWheel(Tick currentTick)
+    : m_now(currentTick) {
+    for (auto& level : m_slots) {
+        for (auto& head : level) {
+            head = kInvalidTimer;
+        }
+    }
+}
+
+TimerWheel::TimerId TimerWheel::schedule(Tick expiry, std::uint64_t cookie) {
+    TimerId id;
+    if (m_freeHead != kInvalidTimer) {
+        id = m_freeHead;
+        m_freeHead = m_nodes[id].next;
+    } else {
+        id = static_cast<TimerId>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    Node& node = m_nodes[id];
+    node.expiry = expiry > m_now ? expiry : m_now + 1;
+    node.cookie = cookie;
+    node.active = true;
+    link(id);
+    ++m_active;
+    return id;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    if (id >= m_nodes.size() || !m_nodes[id].active) {
+        return false;
+    }
+    unlink(id);
+    m_nodes[id].active = false;
+    m_nodes[id].next = m_freeHead;
+    m_freeHead = id;
+    --m_active;
+    return true;
+}
+
+void TimerWheel::advance(Tick now, std::vector<std::uint64_t>& expired) {
+    while (m_now < now) {
+        Tick tick = m_now + 1;
+
+        // 低层全部为空时，直接跳到下一个可能发生级联的边界
+        int emptyLevels = 0;
+        while (emptyLevels < kLevels && m_occupied[emptyLevels] == 0) {
+            ++emptyLevels;
+        }
+        if (emptyLevels == kLevels) {
+            m_now = now;
+            break;
+        }
+        if (emptyLevels > 0) {
+            const Tick span = Tick{1} << (kLevelBits * emptyLevels);
+            const Tick boundary = (tick + span - 1) & ~(span - 1);
+            if (boundary > now) {
+                m_now = now;
+                break;
+            }
+            tick = boundary;
+        }
+        m_now = tick;
+
+        // 自顶向下级联，使高层定时器能在同一刻度内逐层落到第0层
+        for (int level = kLevels - 1; level > 0; --level) {
+            const Tick span = Tick{1} << (kLevelBits * level);
+            if ((tick & (span - 1)) == 0) {
+                cascade(level, tick);
+            }
+        }
+
+        const auto slot = static_cast<std::size_t>(tick & kSlotMask);
+        TimerId id = m_slots[0][slot];
+        m_slots[0][slot] = kInvalidTimer;
+        m_occupied[0] &= ~(std::uint64_t{1} << slot);
+        while (id != kInvalidTimer) {
+            Node& node = m_nodes[id];
+            const TimerId next = node.next;
+            expired.push_back(node.cookie);
+            node.active = false;
+            node.next = m_freeHead;
+            m_freeHead = id;
+            --m_active;
+            id = next;
+        }
+    }
+}
+
+TimerWheel::Tick TimerWheel::nextExpiry() const {
+    Tick best = kNoExpiry;
+    for (int level = 0; level < kLevels; ++level) {
+        const std::uint64_t occupied = m_occupied[level];
+        if (occupied == 0) {
+            continue;
+        }
+
+        Tick candidate;
+        if (level == 0) {
+            const Tick base = m_now + 1;
+            const auto start = static_cast<unsigned>(base & kSlotMask);
+            candidate = base + lowestSetBit(rotateRight(occupied, start));
+        } else {
+            const int shift = kLevelBits * level;
+            const Tick cursor = m_now >> shift;
+            const auto start = static_cast<unsigned>((cursor + 1) & kSlotMask);
+            candidate = (cursor + 1 + lowestSetBit(rotateRight(occupied, start))) << shift;
+        }
+        if (candidate < best) {
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+void TimerWheel::link(TimerId id) {
+    Node& node = m_nodes[id];
+    const Tick delta = node.expiry - m_now;
+    const Tick placed = delta > kMaxDelta ? m_now + kMaxDelta : node.expiry;
+    const Tick span = placed - m_now;
+
+    int level = 0;
+    while (level < kLevels - 1 && span >= (Tick{1} << (kLevelBits * (level + 1)))) {
+        ++level;
+    }
+    const auto slot = static_cast<std::size_t>((placed >> (kLevelBits * level)) & kSlotMask);
+
+    TimerId& head = m_slots[level][slot];
+    node.slot = static_cast<std::uint16_t>(level * kSlotsPerLevel + slot);
+    node.prev = kInvalidTimer;
+    node.next = head;
+    if (head != kInvalidTimer) {
+        m_nodes[head].prev = id;
+    }
+    head = id;
+    m_occupied[level] |= std::uint64_t{1} << slot;
+}
+
+void TimerWheel::unlink(TimerId id) {
+    Node& node = m_nodes[id];
+    const int level = node.slot / kSlotsPerLevel;
+    const int slot = node.slot % kSlotsPerLevel;
+
+    if (node.prev != kInvalidTimer) {
+        m_nodes[node.prev].next = node.next;
+    } else {
+        m_slots[level][slot] = node.next;
+    }
+    if (node.next != kInvalidTimer) {
+        m_nodes[node.next].prev = node.prev;
+    }
+    if (m_slots[level][slot] == kInvalidTimer) {
+        m_occupied[level] &= ~(std::uint64_t{1} << slot);
+    }
+}
+
+void TimerWheel::cascade(int level, Tick tick) {
+    const auto slot = static_cast<std::size_t>((tick >> (kLevelBits * level)) & kSlotMask);
+    TimerId id = m_slots[level][slot];
+    m_slots[level][slot] = kInvalidTimer;
+    m_occupied[level] &= ~(std::uint64_t{1} << slot);
+    while (id != kInvalidTimer) {
+        const TimerId next = m_nodes[id].next;
+        link(id);
+        id = next;
+    }
+}
@@ -1,44 +1,195 @@
 #include "ToleranceChecker.h"
-#include <iostream>
+#include "Logger.h"
+#include "ThreadAffinity.h"
+#include <cerrno>
 #include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <exception>
+#include <new>
+
+namespace {
+
+// 单一写入者的计数器自增，避免原子读改写的开销
+inline void bump(std::atomic<std::uint64_t>& counter) {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// 将[0, count)分块并行处理，数量较少或只有一个硬件线程时在调用线程上完成；
+// 任一分块抛出的异常在全部分块结束后于调用线程上重新抛出
+template <typename Fn>
+void parallelChunks(std::size_t count, Fn&& fn) {
+    constexpr std::size_t kMinChunk = 8192;
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t chunkCount = std::min(hardware, (count + kMinChunk - 1) / kMinChunk);
+    if (chunkCount <= 1) {
+        fn(std::size_t{0}, count);
+        return;
+    }
+    
+    const std::size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    auto runChunk = [&](std::size_t begin, std::size_t end) {
+        try {
+            fn(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(chunkCount - 1);
+    for (std::size_t chunk = 1; chunk < chunkCount; ++chunk) {
+        const std::size_t begin = chunk * chunkSize;
+        threads.emplace_back(runChunk, begin, std::min(count, begin + chunkSize));
+    }
+    runChunk(std::size_t{0}, std::min(count, chunkSize));
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// 换算生效的退出阈值：未配置（<=0）或宽于进入阈值时与进入阈值相同，配置时不低于floor
+inline double exitThreshold(double enter, double exit, double floor = 0.0) {
+    return exit > 0.0 && exit < enter ? std::max(exit, floor) : enter;
+}
+
+} // namespace
 
 ToleranceChecker& ToleranceChecker::getInstance() {
+    // 先于监控器构造日志实例，使其在监控器析构之后才销毁
+    Logger::instance();
     static ToleranceChecker instance;
     instance.startMonitoring();
     return instance;
 }
 
+ToleranceChecker::ToleranceChecker(int defaultSamplePeriodMs, std::shared_ptr<Clock> clock)
+    : m_clock(clock ? std::move(clock) : SteadyClock::instance()),
+      m_epoch(m_clock->now()),
+      m_checkIntervalMs(defaultSamplePeriodMs > 0 ? defaultSamplePeriodMs : 100) {
+}
+
 ToleranceChecker::~ToleranceChecker() {
     stopMonitoring();
 }
 
-bool ToleranceChecker::registerSignal(const std::string& signalId, const SignalConfig& config) {
+SignalHandle ToleranceChecker::registerSignal(const std::string& signalId, const SignalConfig& config) {
     std::lock_guard<std::mutex> lock(m_signalsMutex);
     
-    if (m_signals.find(signalId) != m_signals.end()) {
-        std::cerr << "信号 " << signalId << " 已经注册" << std::endl;
-        return false;
+    auto current = std::atomic_load(&m_snapshot);
+    std::shared_ptr<const SignalGroup> group;
+    if (!validateRegistrationLocked(*current, signalId, config, group)) {
+        return SignalHandle{};
     }
     
-    auto result = m_signals.emplace(signalId, SignalInfo{});
-    auto& signalInfo = result.first->second;
-    signalInfo.config = config;
-    signalInfo.registrationTime = std::chrono::steady_clock::now();
+    auto signalInfo = std::make_shared<SignalInfo>();
+    signalInfo->signalId = signalId;
+    signalInfo->config = config;
+    signalInfo->group = std::move(group);
+    if (config.historyDepth > 0) {
+        signalInfo->history = std::make_shared<SampleHistory>(config.historyDepth);
+    }
+    signalInfo->registrationTime = m_clock->now();
+    signalInfo->stateSince.store(signalInfo->registrationTime.time_since_epoch().count(), std::memory_order_relaxed);
     
-    std::cout << "信号 " << signalId << " 注册成功" << std::endl;
-    return true;
+    // 写时复制：新表发布后，正在读取旧表的线程不受影响
+    auto next = std::make_shared<SignalTable>(*current);
+    SignalHandle handle = insertSignalLocked(*next, std::move(signalInfo));
+    std::atomic_store(&m_snapshot, std::shared_ptr<const SignalTable>(std::move(next)));
+    m_wakeCondition.notify_one();
+    
+    TC_LOG_INFO("信号 %s 注册成功", signalId.c_str());
+    return handle;
+}
+
+std::vector<SignalHandle> ToleranceChecker::registerSignals(const std::vector<SignalRegistration>& signals) {
+    std::vector<SignalHandle> handles(signals.size());
+    if (signals.empty()) {
+        return handles;
+    }
+    
+    // 复制ID与配置（含std::function）是批量注册的主要开销，在锁外并行完成；
+    // 样本历史在锁内通过内存上限检查后才分配，被拒绝的信号不占用内存
+    const auto registrationTime = m_clock->now();
+    std::vector<std::shared_ptr<SignalInfo>> infos(signals.size());
+    parallelChunks(signals.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            auto signalInfo = std::make_shared<SignalInfo>();
+            signalInfo->signalId = signals[i].first;
+            signalInfo->config = signals[i].second;
+            signalInfo->registrationTime = registrationTime;
+            signalInfo->stateSince.store(registrationTime.time_since_epoch().count(), std::memory_order_relaxed);
+            infos[i] = std::move(signalInfo);
+        }
+    });
+    
+    std::size_t registered = 0;
+    std::shared_ptr<const SignalTable> previous;  // 旧表在解锁后才释放
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        previous = std::atomic_load(&m_snapshot);
+        auto next = std::make_shared<SignalTable>(*previous);
+        next->byId.reserve(next->byId.size() + signals.size());
+        next->slots.reserve(m_slotGenerations.size() + signals.size());
+        m_pendingChanges.reserve(m_pendingChanges.size() + signals.size());
+        
+        // 逐项检查新表，批内重复的ID同样被拒绝
+        for (std::size_t i = 0; i < infos.size(); ++i) {
+            SignalInfo& signalInfo = *infos[i];
+            if (!validateRegistrationLocked(*next, signalInfo.signalId, signalInfo.config, signalInfo.group)) {
+                continue;
+            }
+            if (signalInfo.config.historyDepth > 0) {
+                try {
+                    signalInfo.history = std::make_shared<SampleHistory>(signalInfo.config.historyDepth);
+                } catch (const std::bad_alloc&) {
+                    TC_LOG_WARN("信号 %s 的样本历史分配失败", signalInfo.signalId.c_str());
+                    continue;
+                }
+            }
+            handles[i] = insertSignalLocked(*next, std::move(infos[i]));
+            ++registered;
+        }
+        
+        if (registered > 0) {
+            std::atomic_store(&m_snapshot, std::shared_ptr<const SignalTable>(std::move(next)));
+            m_wakeCondition.notify_one();
+        }
+    }
+    
+    TC_LOG_INFO("批量注册信号 %zu 个，成功 %zu 个", signals.size(), registered);
+    return handles;
+}
+
+SignalHandle ToleranceChecker::findSignal(const std::string& signalId) const {
+    auto signalInfo = lookupSignal(signalId);
+    return signalInfo ? signalInfo->handle : SignalHandle{};
 }
 
+bool ToleranceChecker::isRegistered(SignalHandle handle) const {
+    return lookupSignal(handle) != nullptr;
+}
 
 void ToleranceChecker::startMonitoring() {
     if (m_isMonitoring.load()) {
-        std::cout << "监控已经在运行中" << std::endl;
+        TC_LOG_DEBUG("监控已经在运行中");
+        return;
+    }
+    if (!m_clock->isRealTime()) {
+        TC_LOG_ERROR("使用虚拟时钟时不能启动监控线程，请推进时钟并调用runOnce()");
         return;
     }
     m_isMonitoring.store(true);
     m_monitoringThread = std::thread(&ToleranceChecker::monitoringLoop, this);
 
-    std::cout << "开始监控，检查间隔: " << m_checkIntervalMs << "ms" << std::endl;
+    TC_LOG_INFO("开始监控，默认采样周期: %dms", m_checkIntervalMs);
 }
 
 void ToleranceChecker::stopMonitoring() {
@@ -46,13 +197,41 @@ void ToleranceChecker::stopMonitoring() {
         return;
     }
     
-    m_isMonitoring.store(false);
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_isMonitoring.store(false);
+    }
+    m_wakeCondition.notify_all();
     
     if (m_monitoringThread.joinable()) {
         m_monitoringThread.join();
     }
     
-    std::cout << "监控已停止" << std::endl;
+    TC_LOG_INFO("监控已停止");
+    Logger::instance().flush();
+}
+
+void ToleranceChecker::setCpuAffinity(const std::vector<unsigned>& cpus) {
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_affinityPending = true;
+        m_pendingAffinity = cpus;
+    }
+    m_wakeCondition.notify_one();
+}
+
+void ToleranceChecker::configureRealtime(const RealtimeConfig& config) {
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_realtimePending = true;
+        m_pendingRealtime = config;
+    }
+    m_wakeCondition.notify_one();
+}
+
+RealtimeReport ToleranceChecker::getRealtimeReport() const {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    return m_realtimeReport;
 }
 
 bool ToleranceChecker::isMonitoring() const {
@@ -62,73 +241,1290 @@ bool ToleranceChecker::isMonitoring() const {
 void ToleranceChecker::removeSignal(const std::string& signalId) {
     std::lock_guard<std::mutex> lock(m_signalsMutex);
     
-    auto it = m_signals.find(signalId);
-    if (it != m_signals.end()) {
-        m_signals.erase(it);
-        std::cout << "信号 " << signalId << " 已移除" << std::endl;
+    auto current = std::atomic_load(&m_snapshot);
+    auto it = current->byId.find(signalId);
+    if (it != current->byId.end()) {
+        removeSignalLocked(*current, it->second);
     }
 }
 
+bool ToleranceChecker::removeSignal(SignalHandle handle) {
+    std::lock_guard<std::mutex> lock(m_signalsMutex);
+    
+    auto current = std::atomic_load(&m_snapshot);
+    auto signalInfo = current->find(handle);
+    if (!signalInfo) {
+        return false;
+    }
+    removeSignalLocked(*current, signalInfo);
+    return true;
+}
+
+bool ToleranceChecker::registerSignalGroup(const std::string& groupId, BatchValueProvider provider) {
+    if (!provider) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_signalsMutex);
+    auto group = std::make_shared<SignalGroup>();
+    group->groupId = groupId;
+    group->provider = std::move(provider);
+    if (!m_groups.emplace(groupId, std::move(group)).second) {
+        TC_LOG_WARN("信号组 %s 已经注册", groupId.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool ToleranceChecker::removeSignalGroup(const std::string& groupId) {
+    std::lock_guard<std::mutex> lock(m_signalsMutex);
+    return m_groups.erase(groupId) > 0;
+}
+
+bool ToleranceChecker::isSignalGroupRegistered(const std::string& groupId) const {
+    std::lock_guard<std::mutex> lock(m_signalsMutex);
+    return m_groups.find(groupId) != m_groups.end();
+}
+
 SignalState ToleranceChecker::getSignalState(const std::string& signalId) const {
+    auto signalInfo = lookupSignal(signalId);
+    return signalInfo ? signalInfo->state.load() : SignalState::NORMAL;
+}
+
+SignalState ToleranceChecker::getSignalState(SignalHandle handle) const {
+    auto signalInfo = lookupSignal(handle);
+    return signalInfo ? signalInfo->state.load() : SignalState::NORMAL;
+}
+
+SampleHistoryView ToleranceChecker::getSampleHistory(SignalHandle handle) const {
+    auto signalInfo = lookupSignal(handle);
+    return signalInfo ? SampleHistory::view(signalInfo->history) : SampleHistoryView{};
+}
+
+SampleHistoryView ToleranceChecker::getSampleHistory(const std::string& signalId) const {
+    auto signalInfo = lookupSignal(signalId);
+    return signalInfo ? SampleHistory::view(signalInfo->history) : SampleHistoryView{};
+}
+
+std::size_t ToleranceChecker::exportSampleHistory(SignalHandle handle, HistorySample* out,
+                                                  std::size_t capacity) const {
+    auto signalInfo = lookupSignal(handle);
+    if (!signalInfo || !signalInfo->history) {
+        return 0;
+    }
+    return signalInfo->history->copy(out, capacity);
+}
+
+void ToleranceChecker::setHistoryMemoryLimit(std::size_t bytes) {
     std::lock_guard<std::mutex> lock(m_signalsMutex);
+    m_historyLimitBytes = bytes;
+}
+
+HistoryMemoryUsage ToleranceChecker::getHistoryMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(m_signalsMutex);
+    HistoryMemoryUsage usage;
+    usage.limitBytes = m_historyLimitBytes;
+    usage.usedBytes = m_historyBytes;
+    usage.signalCount = m_historySignals;
+    return usage;
+}
+
+bool ToleranceChecker::pushValue(const std::string& signalId, double value,
+                                 std::chrono::steady_clock::time_point timestamp, PushMode mode) {
+    auto signalInfo = lookupSignal(signalId);
+    if (!signalInfo) {
+        return false;
+    }
+    pushSample(std::move(signalInfo), value, timestamp, mode);
+    return true;
+}
+
+bool ToleranceChecker::pushValue(SignalHandle handle, double value,
+                                 std::chrono::steady_clock::time_point timestamp, PushMode mode) {
+    auto signalInfo = lookupSignal(handle);
+    if (!signalInfo) {
+        return false;
+    }
+    pushSample(std::move(signalInfo), value, timestamp, mode);
+    return true;
+}
+
+template <typename Retire>
+std::size_t ToleranceChecker::removeSignalsBatch(Retire&& retire) {
+    // 旧表在解锁后才释放，大表的析构不占用注册表锁
+    std::shared_ptr<const SignalTable> previous;
+    std::lock_guard<std::mutex> lock(m_signalsMutex);
+    previous = std::atomic_load(&m_snapshot);
+    auto next = std::make_shared<SignalTable>(*previous);
+    std::size_t removed = retire(*next);
+    if (removed > 0) {
+        // 大批移除后收缩表尾的空槽位，并让后续注册优先复用低位槽位，
+        // 避免之后每次写时复制都要拷贝一张几乎全空的大表
+        while (!next->slots.empty() && !next->slots.back()) {
+            next->slots.pop_back();
+        }
+        std::sort(m_freeSlots.begin(), m_freeSlots.end(), std::greater<std::uint32_t>());
+        std::atomic_store(&m_snapshot, std::shared_ptr<const SignalTable>(std::move(next)));
+        m_wakeCondition.notify_one();
+    }
+    return removed;
+}
+
+std::size_t ToleranceChecker::removeSignals(const std::vector<SignalHandle>& handles) {
+    std::size_t removed = removeSignalsBatch([&](SignalTable& next) {
+        std::size_t count = 0;
+        for (SignalHandle handle : handles) {
+            // 已在本批中移除的句柄在新表中查不到，不会重复计数
+            auto signalInfo = next.find(handle);
+            if (signalInfo) {
+                retireSignalLocked(next, signalInfo);
+                ++count;
+            }
+        }
+        return count;
+    });
+    TC_LOG_INFO("批量移除信号 %zu 个", removed);
+    return removed;
+}
+
+std::size_t ToleranceChecker::removeSignals(const std::vector<std::string>& signalIds) {
+    std::size_t removed = removeSignalsBatch([&](SignalTable& next) {
+        std::size_t count = 0;
+        for (const auto& signalId : signalIds) {
+            auto it = next.byId.find(signalId);
+            if (it != next.byId.end()) {
+                // 先取得所有权，retireSignalLocked会从byId中删除该项
+                auto signalInfo = it->second;
+                retireSignalLocked(next, signalInfo);
+                ++count;
+            }
+        }
+        return count;
+    });
+    TC_LOG_INFO("批量移除信号 %zu 个", removed);
+    return removed;
+}
+
+std::shared_ptr<SignalInfo> ToleranceChecker::SignalTable::find(SignalHandle handle) const {
+    if (!handle || handle.index >= slots.size()) {
+        return nullptr;
+    }
+    const auto& signalInfo = slots[handle.index];
+    if (!signalInfo || signalInfo->handle.generation != handle.generation) {
+        return nullptr;
+    }
+    return signalInfo;
+}
+
+std::shared_ptr<const ToleranceChecker::SignalTable> ToleranceChecker::loadSnapshot() const {
+    std::unique_lock<std::mutex> lock(m_signalsMutex, std::defer_lock);
+    if (m_registryMode.load() == RegistryMode::LOCKED) {
+        lock.lock();
+    }
+    return std::atomic_load(&m_snapshot);
+}
+
+std::shared_ptr<SignalInfo> ToleranceChecker::lookupSignal(const std::string& signalId) const {
+    auto snapshot = loadSnapshot();
+    auto it = snapshot->byId.find(signalId);
+    return it != snapshot->byId.end() ? it->second : nullptr;
+}
+
+std::shared_ptr<SignalInfo> ToleranceChecker::lookupSignal(SignalHandle handle) const {
+    return loadSnapshot()->find(handle);
+}
+
+void ToleranceChecker::readStatus(const SignalInfo& signalInfo, SignalStatus& status) {
+    // 顺序锁读取：序号为奇数或前后不一致时说明检查线程正在写入，重读
+    std::uint64_t before;
+    std::uint64_t after;
+    do {
+        before = signalInfo.statusSequence.load(std::memory_order_acquire);
+        status.state = signalInfo.state.load(std::memory_order_relaxed);
+        status.lastValue = signalInfo.lastValue.load(std::memory_order_relaxed);
+        status.since = std::chrono::steady_clock::time_point(
+            std::chrono::steady_clock::duration(signalInfo.stateSince.load(std::memory_order_relaxed)));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = signalInfo.statusSequence.load(std::memory_order_relaxed);
+    } while ((before & 1) != 0 || before != after);
+    status.handle = signalInfo.handle;
+}
+
+std::size_t ToleranceChecker::getSignalStates(SignalStatus* out, std::size_t capacity) const {
+    auto snapshot = loadSnapshot();
+    std::size_t total = 0;
+    for (const auto& signalInfo : snapshot->slots) {
+        if (!signalInfo) {
+            continue;
+        }
+        if (total < capacity) {
+            readStatus(*signalInfo, out[total]);
+        }
+        ++total;
+    }
+    return total;
+}
+
+std::size_t ToleranceChecker::getSignalStates(const SignalHandle* handles, std::size_t count,
+                                              SignalStatus* out) const {
+    auto snapshot = loadSnapshot();
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        // 直接引用快照中的指针，避免逐项增减引用计数
+        const SignalHandle handle = handles[i];
+        const SignalInfo* signalInfo = handle && handle.index < snapshot->slots.size()
+            ? snapshot->slots[handle.index].get() : nullptr;
+        if (!signalInfo || signalInfo->handle.generation != handle.generation) {
+            out[i] = SignalStatus{};
+            continue;
+        }
+        readStatus(*signalInfo, out[i]);
+        ++found;
+    }
+    return found;
+}
+
+bool ToleranceChecker::validateRegistrationLocked(const SignalTable& table, const std::string& signalId,
+                                                  const SignalConfig& config,
+                                                  std::shared_ptr<const SignalGroup>& group) const {
+    if (table.byId.find(signalId) != table.byId.end()) {
+        TC_LOG_WARN("信号 %s 已经注册", signalId.c_str());
+        return false;
+    }
+    
+    group.reset();
+    if (!config.groupId.empty()) {
+        auto groupIt = m_groups.find(config.groupId);
+        if (groupIt == m_groups.end()) {
+            TC_LOG_WARN("信号 %s 所属的信号组 %s 未注册", signalId.c_str(), config.groupId.c_str());
+            return false;
+        }
+        group = groupIt->second;
+    }
+    
+    if (config.sharedSegment && config.sharedSlot >= config.sharedSegment->slotCount()) {
+        TC_LOG_WARN("信号 %s 的共享内存槽位 %u 超出段 %s 的范围", signalId.c_str(),
+                    static_cast<unsigned>(config.sharedSlot), config.sharedSegment->name().c_str());
+        return false;
+    }
+    
+    if (config.historyDepth > 0 &&
+        m_historyBytes + SampleHistory::footprint(config.historyDepth) > m_historyLimitBytes) {
+        TC_LOG_WARN("信号 %s 的样本历史超出内存上限（已用 %zu / %zu 字节）", signalId.c_str(),
+                    m_historyBytes, m_historyLimitBytes);
+        return false;
+    }
+    return true;
+}
+
+SignalHandle ToleranceChecker::insertSignalLocked(SignalTable& next, std::shared_ptr<SignalInfo> signalInfo) {
+    // 优先复用已释放的槽位，槽位代数在移除时递增，使旧句柄失效
+    SignalHandle handle;
+    if (!m_freeSlots.empty()) {
+        handle.index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        handle.index = static_cast<std::uint32_t>(m_slotGenerations.size());
+        m_slotGenerations.push_back(1);
+    }
+    handle.generation = m_slotGenerations[handle.index];
+    signalInfo->handle = handle;
+    
+    next.byId.emplace(signalInfo->signalId, signalInfo);
+    if (next.slots.size() <= handle.index) {
+        next.slots.resize(handle.index + 1);
+    }
+    next.slots[handle.index] = signalInfo;
     
-    auto it = m_signals.find(signalId);
-    if (it != m_signals.end()) {
-        return it->second.state;
+    if (signalInfo->history) {
+        m_historyBytes += SampleHistory::footprint(signalInfo->history->capacity());
+        ++m_historySignals;
     }
     
-    return SignalState::NORMAL;
+    // 由监控线程在下一轮开始前挂入时间轮
+    m_pendingChanges.push_back({std::move(signalInfo), true});
+    return handle;
 }
 
-void ToleranceChecker::monitoringLoop() {
-    while (m_isMonitoring.load()) {
+void ToleranceChecker::retireSignalLocked(SignalTable& next, const std::shared_ptr<SignalInfo>& signalInfo) {
+    next.byId.erase(signalInfo->signalId);
+    next.slots[signalInfo->handle.index].reset();
+    
+    if (signalInfo->history) {
+        m_historyBytes -= SampleHistory::footprint(signalInfo->history->capacity());
+        --m_historySignals;
+    }
+    
+    // 槽位代数递增（跳过表示无效的0），旧句柄随即失效
+    const std::uint32_t index = signalInfo->handle.index;
+    if (++m_slotGenerations[index] == 0) {
+        m_slotGenerations[index] = 1;
+    }
+    m_freeSlots.push_back(index);
+    
+    signalInfo->removed.store(true);
+    
+    // 待删除的信号由变更队列持有，直到监控线程将其移出时间轮
+    m_pendingChanges.push_back({signalInfo, false});
+}
+
+void ToleranceChecker::removeSignalLocked(const SignalTable& current,
+                                          const std::shared_ptr<SignalInfo>& signalInfo) {
+    auto next = std::make_shared<SignalTable>(current);
+    retireSignalLocked(*next, signalInfo);
+    std::atomic_store(&m_snapshot, std::shared_ptr<const SignalTable>(std::move(next)));
+    m_wakeCondition.notify_one();
+    
+    TC_LOG_INFO("信号 %s 已移除", signalInfo->signalId.c_str());
+}
+
+void ToleranceChecker::pushSample(std::shared_ptr<SignalInfo> signalInfo, double value,
+                                  std::chrono::steady_clock::time_point timestamp, PushMode mode) {
+    if (timestamp == std::chrono::steady_clock::time_point{}) {
+        timestamp = m_clock->now();
+    }
+    // 顺序锁写入：先将序号置为奇数，写完后再置为下一个偶数
+    std::uint64_t sequence = signalInfo->pushSequence.load(std::memory_order_relaxed);
+    do {
+        while (sequence & 1u) {
+            sequence = signalInfo->pushSequence.load(std::memory_order_relaxed);
+        }
+    } while (!signalInfo->pushSequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire));
+    signalInfo->pushedValue.store(value, std::memory_order_relaxed);
+    signalInfo->pushedTime.store(timestamp.time_since_epoch().count(), std::memory_order_relaxed);
+    signalInfo->pushSequence.store(sequence + 2, std::memory_order_release);
+    
+    // 同一信号在被评估前只入队一次
+    if (mode == PushMode::IMMEDIATE && !signalInfo->pushQueued.exchange(true)) {
+        bool first;
+        {
+            std::lock_guard<std::mutex> pushLock(m_pushMutex);
+            first = m_pushedSignals.empty();
+            m_pushedSignals.push_back(std::move(signalInfo));
+        }
+        if (first) {
+            {
+                std::lock_guard<std::mutex> lock(m_signalsMutex);
+                m_pushWakeRequested = true;
+            }
+            m_wakeCondition.notify_one();
+        }
+    }
+}
+
+void ToleranceChecker::setRegistryMode(RegistryMode mode) {
+    m_registryMode.store(mode);
+}
+
+RegistryMode ToleranceChecker::getRegistryMode() const {
+    return m_registryMode.load();
+}
+
+void ToleranceChecker::configureSharding(unsigned workerCount, unsigned shardCount) {
+    if (shardCount == 0) {
+        shardCount = workerCount == 0 ? 1 : workerCount * 4;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_shardingPending = true;
+        m_pendingWorkerCount = workerCount;
+        m_pendingShardCount = shardCount;
+    }
+    m_wakeCondition.notify_one();
+    
+    TC_LOG_INFO("分片监控配置: 工作线程 %u，分片 %u", workerCount, shardCount);
+}
+
+std::vector<ShardStats> ToleranceChecker::getShardStats() const {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    return m_shardStats;
+}
+
+void ToleranceChecker::configureDispatch(unsigned threadCount, std::size_t queueCapacity,
+                                         OverflowPolicy policy) {
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_dispatchPending = true;
+        m_pendingDispatchThreads = threadCount;
+        m_pendingDispatchCapacity = queueCapacity;
+        m_pendingDispatchPolicy = policy;
+    }
+    m_wakeCondition.notify_one();
+    
+    TC_LOG_INFO("回调派发配置: 派发线程 %u，队列容量 %zu，溢出策略 %s", threadCount, queueCapacity,
+                policy == OverflowPolicy::BLOCK ? "BLOCK" : "DROP");
+}
+
+DispatchStats ToleranceChecker::getDispatchStats() const {
+    return m_dispatcher.stats();
+}
+
+void ToleranceChecker::setOverrunPolicy(OverrunPolicy policy) {
+    m_overrunPolicy.store(policy);
+}
+
+OverrunPolicy ToleranceChecker::getOverrunPolicy() const {
+    return m_overrunPolicy.load();
+}
+
+LoopStats ToleranceChecker::getLoopStats() const {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    return m_loopStats;
+}
+
+void ToleranceChecker::enableStats(bool enabled) {
+    if (enabled) {
+        CycleClock::calibrate();
         {
             std::lock_guard<std::mutex> lock(m_signalsMutex);
-            
-            for (auto& [signalId, signalInfo] : m_signals) {
-                checkSignal(signalId, signalInfo);
+            m_statsAllocationPending = true;
+            m_statsEnabled.store(true);
+        }
+        m_wakeCondition.notify_one();
+    } else {
+        m_statsEnabled.store(false);
+    }
+    
+    TC_LOG_INFO("热点路径统计: %s", enabled ? "启用" : "停用");
+}
+
+bool ToleranceChecker::statsEnabled() const {
+    return m_statsEnabled.load();
+}
+
+CheckerStats ToleranceChecker::getStats() const {
+    CheckerStats stats;
+    stats.enabled = m_statsEnabled.load();
+    stats.passLatency = m_passLatency.summary();
+    stats.lockHold = m_lockHold.summary();
+    stats.wakeJitter = m_wakeJitter.summary();
+    stats.groupFetchLatency = m_groupFetchLatency.summary();
+    
+    auto snapshot = std::atomic_load(&m_snapshot);
+    for (const auto& entry : snapshot->byId) {
+        const SignalStatsBlock* block = entry.second->stats.load(std::memory_order_acquire);
+        if (!block) {
+            continue;
+        }
+        stats.samples += block->samples.load(std::memory_order_relaxed);
+        stats.warningTransitions += block->warningTransitions.load(std::memory_order_relaxed);
+        stats.faultTransitions += block->faultTransitions.load(std::memory_order_relaxed);
+        stats.recoveries += block->recoveries.load(std::memory_order_relaxed);
+        stats.valueErrors += block->valueErrors.load(std::memory_order_relaxed);
+    }
+    
+    stats.callbackExceptions = m_dispatcher.stats().exceptions;
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    stats.overruns = m_loopStats.overruns;
+    return stats;
+}
+
+bool ToleranceChecker::getSignalStats(SignalHandle handle, SignalStats& stats) const {
+    auto signalInfo = lookupSignal(handle);
+    const SignalStatsBlock* block = signalInfo ? signalInfo->stats.load(std::memory_order_acquire) : nullptr;
+    if (!block) {
+        return false;
+    }
+    stats.valueLatency = block->valueLatency.summary();
+    stats.samples = block->samples.load(std::memory_order_relaxed);
+    stats.warningTransitions = block->warningTransitions.load(std::memory_order_relaxed);
+    stats.faultTransitions = block->faultTransitions.load(std::memory_order_relaxed);
+    stats.recoveries = block->recoveries.load(std::memory_order_relaxed);
+    stats.valueErrors = block->valueErrors.load(std::memory_order_relaxed);
+    return true;
+}
+
+void ToleranceChecker::enableTransitionStream(std::size_t capacity) {
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_transitionPending = true;
+        m_pendingTransitionCapacity = capacity;
+    }
+    m_wakeCondition.notify_one();
+    
+    TC_LOG_INFO("状态迁移事件流: %s，容量 %zu", capacity > 0 ? "启用" : "停用", capacity);
+}
+
+std::uint64_t ToleranceChecker::subscribeTransitions() const {
+    auto ring = std::atomic_load(&m_transitionRing);
+    return ring ? ring->lastPublished() + 1 : 0;
+}
+
+TransitionReadStatus ToleranceChecker::readTransitions(std::uint64_t& cursor, TransitionEvent* out,
+                                                       std::size_t capacity, std::size_t& count) const {
+    count = 0;
+    auto ring = std::atomic_load(&m_transitionRing);
+    if (!ring) {
+        return TransitionReadStatus::DISABLED;
+    }
+    return ring->read(cursor, out, capacity, count) == BroadcastRing<TransitionEvent>::ReadStatus::OK
+        ? TransitionReadStatus::OK : TransitionReadStatus::OVERRUN;
+}
+
+std::uint64_t ToleranceChecker::resyncTransitions(SignalStatus* out, std::size_t capacity,
+                                                  std::size_t& total) const {
+    // 先取读取位置再读快照：已发布事件对应的状态在发布前就已写入
+    auto ring = std::atomic_load(&m_transitionRing);
+    std::uint64_t cursor = ring ? ring->lastPublished() + 1 : 0;
+    total = getSignalStates(out, capacity);
+    return cursor;
+}
+
+bool ToleranceChecker::enableJournal(const JournalConfig& config) {
+    // 在调用线程上创建目录与第一个段文件，错误可以同步返回
+    std::shared_ptr<JournalWriter> journal = JournalWriter::open(config);
+    if (!journal) {
+        TC_LOG_WARN("启用事件日志失败: %s", std::strerror(errno));
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_journalPending = true;
+        m_pendingJournal = std::move(journal);
+    }
+    m_wakeCondition.notify_one();
+    
+    TC_LOG_INFO("事件日志: 启用，目录 %s，段大小 %zu 字节%s", config.directory.c_str(), config.segmentBytes,
+                config.recordSamples ? "，记录原始样本" : "");
+    return true;
+}
+
+void ToleranceChecker::disableJournal() {
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_journalPending = true;
+        m_pendingJournal.reset();
+    }
+    m_wakeCondition.notify_one();
+    
+    TC_LOG_INFO("事件日志: 停用");
+}
+
+JournalStats ToleranceChecker::getJournalStats() const {
+    auto journal = std::atomic_load(&m_journal);
+    return journal ? journal->stats() : JournalStats{};
+}
+
+bool ToleranceChecker::setTransitionBatchSink(TransitionBatchCallback callback, const BatchConfig& config) {
+    {
+        std::lock_guard<std::mutex> lock(m_batchSinkMutex);
+        if (m_batchSink && m_batchSink->onDeliveryThread()) {
+            TC_LOG_ERROR("不能在批量回调内设置状态迁移批量回调");
+            return false;
+        }
+    }
+    std::shared_ptr<BatchCoalescer<TransitionEvent>> sink;
+    if (callback) {
+        sink = std::make_shared<BatchCoalescer<TransitionEvent>>(std::move(callback), config);
+        TC_LOG_INFO("状态迁移批量回调: 启用，单批上限 %zu，合并窗口 %d 毫秒", sink->config().maxBatch,
+                    sink->config().maxLatencyMs);
+    } else {
+        TC_LOG_INFO("状态迁移批量回调: 停用");
+    }
+    {
+        std::unique_lock<std::mutex> lock(m_batchSinkMutex);
+        m_batchSink.swap(sink);
+        m_batchSinkEnabled.store(m_batchSink != nullptr, std::memory_order_relaxed);
+        // 监控线程可能正在向旧合并器追加事件（BLOCK策略下还可能在等待队列空位），等它放下引用
+        m_batchSinkReleased.wait(lock, [&sink] { return !sink || sink.use_count() == 1; });
+    }
+    
+    // 旧合并器交还调用线程析构：移交未满的批次、交付完剩余事件并等待交付线程退出，
+    // 监控线程不为此停顿，返回后旧回调不会再被调用
+    sink.reset();
+    return true;
+}
+
+std::shared_ptr<BatchCoalescer<TransitionEvent>> ToleranceChecker::acquireBatchSink() {
+    std::lock_guard<std::mutex> lock(m_batchSinkMutex);
+    return m_batchSink;
+}
+
+void ToleranceChecker::releaseBatchSink(std::shared_ptr<BatchCoalescer<TransitionEvent>>& sink) {
+    if (!sink) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_batchSinkMutex);
+        sink.reset();
+    }
+    m_batchSinkReleased.notify_all();
+}
+
+BatchStats ToleranceChecker::getTransitionBatchStats() const {
+    std::lock_guard<std::mutex> lock(m_batchSinkMutex);
+    return m_batchSink ? m_batchSink->stats() : BatchStats{};
+}
+
+void ToleranceChecker::monitoringLoop() {
+    // 上一轮按截止时间唤醒时的抖动，随本轮统计一并记录
+    bool timedWakeup = false;
+    std::chrono::steady_clock::duration wakeJitter{0};
+    
+    while (m_isMonitoring.load()) {
+        applyPendingChanges();
+        recordLoopStats(runPass(), timedWakeup, wakeJitter);
+        
+        // 按绝对截止时间休眠，唤醒时间不受本轮检查耗时影响
+        TimerWheel::Tick next = m_timerWheel.nextExpiry();
+        // 合并窗口到期时也须醒来移交批次，这类唤醒不计入抖动统计
+        const auto batchDeadline = batchSinkDeadline();
+        std::unique_lock<std::mutex> lock(m_signalsMutex);
+        auto wakeUp = [this] {
+            return !m_isMonitoring.load() || !m_pendingChanges.empty() || m_shardingPending ||
+                   m_dispatchPending || m_pushWakeRequested || m_statsAllocationPending || m_transitionPending ||
+                   m_affinityPending || m_realtimePending || m_journalPending;
+        };
+        timedWakeup = false;
+        if (next == TimerWheel::kNoExpiry && batchDeadline == std::chrono::steady_clock::time_point::max()) {
+            m_wakeCondition.wait(lock, wakeUp);
+        } else {
+            // 截止时间已过（本轮超期）时不休眠，也不计入唤醒抖动，其影响体现在滞后统计中
+            auto deadline = next == TimerWheel::kNoExpiry ? std::chrono::steady_clock::time_point::max()
+                                                          : m_epoch + std::chrono::milliseconds(next);
+            const bool batchWakeup = batchDeadline < deadline;
+            deadline = std::min(deadline, batchDeadline);
+            bool sleeping = deadline > std::chrono::steady_clock::now();
+            if (!m_wakeCondition.wait_until(lock, deadline, wakeUp) && sleeping && !batchWakeup) {
+                wakeJitter = std::max(std::chrono::steady_clock::now() - deadline,
+                                      std::chrono::steady_clock::duration::zero());
+                timedWakeup = true;
+                if (m_statsEnabled.load(std::memory_order_relaxed)) {
+                    m_wakeJitter.recordExclusive(static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(wakeJitter).count()));
+                }
             }
         }
+    }
+    
+    // 停止监控时移交合并窗口内尚未交付的迁移
+    auto batchSink = acquireBatchSink();
+    if (batchSink) {
+        batchSink->seal();
+    }
+    releaseBatchSink(batchSink);
+}
+
+bool ToleranceChecker::runOnce() {
+    if (m_isMonitoring.load()) {
+        return false;
+    }
+    applyPendingChanges();
+    recordLoopStats(runPass(), false, std::chrono::steady_clock::duration::zero());
+    return true;
+}
+
+std::chrono::steady_clock::time_point ToleranceChecker::nextDueTime() {
+    if (m_isMonitoring.load()) {
+        return std::chrono::steady_clock::time_point::max();
+    }
+    applyPendingChanges();
+    TimerWheel::Tick next = m_timerWheel.nextExpiry();
+    auto due = next == TimerWheel::kNoExpiry ? std::chrono::steady_clock::time_point::max()
+                                             : m_epoch + std::chrono::milliseconds(next);
+    return std::min(due, batchSinkDeadline());
+}
+
+std::chrono::steady_clock::time_point ToleranceChecker::batchSinkDeadline() const {
+    std::lock_guard<std::mutex> lock(m_batchSinkMutex);
+    return m_batchSink ? m_batchSink->deadline() : std::chrono::steady_clock::time_point::max();
+}
+
+std::chrono::steady_clock::duration ToleranceChecker::runPass() {
+    std::chrono::steady_clock::duration passLateness{0};
+    bool pushDeferred = false;
+    {
+        // LOCKED模式下整轮检查持有锁，与旧实现行为一致
+        std::unique_lock<std::mutex> passLock(m_signalsMutex, std::defer_lock);
+        if (m_registryMode.load() == RegistryMode::LOCKED) {
+            passLock.lock();
+        }
+        const bool recordStats = m_statsEnabled.load(std::memory_order_relaxed);
+        const std::uint64_t passTicks = recordStats ? CycleClock::now() : 0;
         
-        std::this_thread::sleep_for(std::chrono::milliseconds(m_checkIntervalMs));
+        m_expiredSignals.clear();
+        auto passStart = m_clock->now();
+        m_timerWheel.advance(toTick(passStart), m_expiredSignals);
+        
+        TimerWheel::Tick earliestDue = TimerWheel::kNoExpiry;
+        for (std::uint64_t cookie : m_expiredSignals) {
+            auto* signalInfo = reinterpret_cast<SignalInfo*>(static_cast<std::uintptr_t>(cookie));
+            signalInfo->timerId = TimerWheel::kInvalidTimer;
+            earliestDue = std::min(earliestDue, signalInfo->dueTick);
+            m_shardBuckets[signalInfo->shard].push_back(signalInfo);
+        }
+        if (earliestDue != TimerWheel::kNoExpiry) {
+            passLateness = passStart - (m_epoch + std::chrono::milliseconds(earliestDue));
+        }
+        
+        runShards();
+        pushDeferred = evaluatePushedSignals();
+        publishTransitions();
+        
+        if (recordStats) {
+            std::uint64_t passNs = CycleClock::toNs(CycleClock::now() - passTicks);
+            m_passLatency.recordExclusive(passNs);
+            if (passLock.owns_lock()) {
+                m_lockHold.recordExclusive(passNs);
+            }
+        }
+    }
+    
+    // 留到下一轮的推送样本须再次唤醒监控线程；LOCKED模式下上面的作用域持有m_signalsMutex，释放后才能设置
+    if (pushDeferred) {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        m_pushWakeRequested = true;
+    }
+    
+    // 时间轮非线程安全，统一在监控线程上重新调度
+    m_passOverruns = 0;
+    m_passSkippedSamples = 0;
+    for (auto& bucket : m_shardBuckets) {
+        for (SignalInfo* signalInfo : bucket) {
+            rescheduleSignal(*signalInfo);
+        }
+        bucket.clear();
+    }
+    return passLateness;
+}
+
+void ToleranceChecker::recordLoopStats(std::chrono::steady_clock::duration passLateness, bool timedWakeup,
+                                       std::chrono::steady_clock::duration wakeJitter) {
+    std::lock_guard<std::mutex> statsLock(m_statsMutex);
+    ++m_loopStats.iterations;
+    m_loopStats.overruns += m_passOverruns;
+    m_loopStats.skippedSamples += m_passSkippedSamples;
+    auto latenessUs = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(passLateness).count());
+    m_loopStats.worstLatenessUs = std::max(m_loopStats.worstLatenessUs, latenessUs);
+    if (timedWakeup) {
+        auto jitterUs = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(wakeJitter).count());
+        ++m_loopStats.timedWakeups;
+        m_loopStats.lastJitterUs = jitterUs;
+        m_loopStats.maxJitterUs = std::max(m_loopStats.maxJitterUs, jitterUs);
+        m_loopStats.totalJitterUs += jitterUs;
     }
 }
 
-void ToleranceChecker::checkSignal(const std::string& signalId, SignalInfo& sig) {
-    auto now = std::chrono::steady_clock::now();
+void ToleranceChecker::applyPendingChanges() {
+    std::vector<RegistryChange> changes;
+    std::shared_ptr<const SignalTable> snapshot;
+    bool resharding = false;
+    unsigned workerCount = 0;
+    bool redispatching = false;
+    unsigned dispatchThreads = 0;
+    std::size_t dispatchCapacity = 0;
+    OverflowPolicy dispatchPolicy = OverflowPolicy::DROP;
+    bool allocatingStats = false;
+    bool restreaming = false;
+    std::size_t transitionCapacity = 0;
+    bool repinning = false;
+    std::vector<unsigned> affinity;
+    bool realtime = false;
+    RealtimeConfig realtimeConfig;
+    bool rejournaling = false;
+    std::shared_ptr<JournalWriter> journal;
+    std::shared_ptr<const SignalTable> journalSnapshot;
+    const bool recordStats = m_statsEnabled.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_signalsMutex);
+        const std::uint64_t lockStart = recordStats ? CycleClock::now() : 0;
+        changes.swap(m_pendingChanges);
+        if (m_shardingPending) {
+            resharding = true;
+            workerCount = m_pendingWorkerCount;
+            m_shardCount = m_pendingShardCount;
+            m_shardingPending = false;
+            // 与变更队列在同一临界区内取快照，保证两者一致
+            snapshot = std::atomic_load(&m_snapshot);
+        }
+        m_pushWakeRequested = false;
+        if (m_dispatchPending) {
+            redispatching = true;
+            dispatchThreads = m_pendingDispatchThreads;
+            dispatchCapacity = m_pendingDispatchCapacity;
+            dispatchPolicy = m_pendingDispatchPolicy;
+            m_dispatchPending = false;
+        }
+        if (m_affinityPending) {
+            repinning = true;
+            affinity.swap(m_pendingAffinity);
+            m_affinityPending = false;
+        }
+        if (m_realtimePending) {
+            realtime = true;
+            realtimeConfig = std::move(m_pendingRealtime);
+            m_realtimePending = false;
+        }
+        if (m_journalPending) {
+            rejournaling = true;
+            journal = std::move(m_pendingJournal);
+            m_journalPending = false;
+            // 与变更队列在同一临界区内取快照：本批新注册的信号已在快照中，不必再单独写入
+            journalSnapshot = std::atomic_load(&m_snapshot);
+        }
+        if (m_transitionPending) {
+            restreaming = true;
+            transitionCapacity = m_pendingTransitionCapacity;
+            m_transitionPending = false;
+        }
+        if (m_statsAllocationPending) {
+            allocatingStats = true;
+            m_statsAllocationPending = false;
+            snapshot = std::atomic_load(&m_snapshot);
+        }
+        if (recordStats) {
+            m_lockHold.recordExclusive(CycleClock::toNs(CycleClock::now() - lockStart));
+        }
+    }
     
-    // 获取当前信号值
+    // 快照之外的新信号在下面处理变更时分配
+    if (allocatingStats) {
+        for (const auto& entry : snapshot->byId) {
+            allocateSignalStats(*entry.second);
+        }
+    }
+    
+    // 之后由监控线程创建的工作线程与派发线程继承监控线程的亲和性
+    if (repinning) {
+        bool pinned = setCurrentThreadAffinity(affinity);
+        if (m_workerPool && !resharding) {
+            pinned = m_workerPool->setAffinity(affinity) && pinned;
+        }
+        if (pinned) {
+            std::string cpuList;
+            for (unsigned cpu : affinity) {
+                cpuList += (cpuList.empty() ? "" : ",") + std::to_string(cpu);
+            }
+            TC_LOG_INFO("监控线程CPU亲和性: %s", cpuList.empty() ? "不限" : cpuList.c_str());
+        } else {
+            TC_LOG_WARN("设置监控线程CPU亲和性失败");
+        }
+    }
+    
+    // 调度策略与亲和性同样由之后创建的线程继承；报告中的值从内核读回
+    RealtimeReport realtimeReport;
+    if (realtime) {
+        realtimeReport = applyRealtimeConfig(realtimeConfig);
+        if (m_workerPool && !resharding) {
+            bool applied = m_workerPool->setScheduling(realtimeConfig.policy, realtimeConfig.priority);
+            if (!realtimeConfig.cpus.empty()) {
+                applied = m_workerPool->setAffinity(realtimeConfig.cpus) && applied;
+            }
+            if (!applied) {
+                TC_LOG_WARN("设置分片工作线程的实时配置失败");
+            }
+        }
+        const bool granted = realtimeReport.schedulingError == 0 && realtimeReport.affinityError == 0 &&
+                             realtimeReport.memoryLockError == 0;
+        const std::string description = describeRealtimeReport(realtimeReport);
+        if (granted) {
+            TC_LOG_INFO("实时配置: %s", description.c_str());
+        } else {
+            TC_LOG_WARN("实时配置未完全生效: %s", description.c_str());
+        }
+    }
+    
+    // 监控线程是事件流唯一的写者，新事件流的序号接续旧事件流
+    if (restreaming) {
+        if (m_transitionWriter) {
+            m_nextTransitionSequence = m_transitionWriter->nextSequence();
+        }
+        std::shared_ptr<BroadcastRing<TransitionEvent>> ring;
+        if (transitionCapacity > 0) {
+            ring = std::make_shared<BroadcastRing<TransitionEvent>>(transitionCapacity, m_nextTransitionSequence);
+        }
+        m_transitionWriter = ring.get();
+        std::atomic_store(&m_transitionRing, std::move(ring));
+    }
+    
+    // 监控线程是事件日志唯一的写者，旧日志在此关闭（截断预分配空间）
+    if (rejournaling) {
+        m_journalWriter = journal.get();
+        m_journalSamples = journal && journal->config().recordSamples;
+        if (m_journalWriter) {
+            journalSignals(*journalSnapshot);
+        }
+        std::atomic_store(&m_journal, std::move(journal));
+    }
+    
+    // 检查线程此时均空闲，可以安全地切换派发器
+    if (redispatching) {
+        m_dispatcher.start(dispatchThreads, dispatchCapacity, dispatchPolicy);
+    }
+    
+    std::lock_guard<std::mutex> statsLock(m_statsMutex);
+    if (realtime) {
+        m_realtimeReport = std::move(realtimeReport);
+    }
+    if (resharding) {
+        m_workerPool.reset();
+        if (workerCount > 0) {
+            m_workerPool = std::make_unique<WorkerPool>(workerCount);
+        }
+        m_shardBuckets.assign(m_shardCount, {});
+        m_shardStats.assign(m_shardCount, ShardStats{});
+        m_shardScratch.assign(m_shardCount, ShardScratch{});
+        
+        // 快照已包含本批新注册的信号且不含本批移除的信号，计数以快照为准
+        for (const auto& [signalId, signalInfo] : snapshot->byId) {
+            signalInfo->shard = shardOf(*signalInfo);
+            ++m_shardStats[signalInfo->shard].signalCount;
+        }
+    }
+    
+    for (auto& change : changes) {
+        SignalInfo& signalInfo = *change.signal;
+        if (change.added) {
+            if (!resharding) {
+                signalInfo.shard = shardOf(signalInfo);
+                ++m_shardStats[signalInfo.shard].signalCount;
+            }
+            const SignalConfig& config = signalInfo.config;
+            m_hotStore.setThresholds(signalInfo.handle.index, config.targetValue,
+                                     config.warningThreshold, config.faultThreshold);
+            signalInfo.warningExitThreshold = exitThreshold(config.warningThreshold, config.warningExitThreshold);
+            // 故障退出阈值不低于警告进入阈值，离开故障后的偏差仍落在警告区间内
+            signalInfo.faultExitThreshold = exitThreshold(config.faultThreshold, config.faultExitThreshold,
+                                                          config.warningThreshold);
+            signalInfo.hysteresis = signalInfo.warningExitThreshold != config.warningThreshold ||
+                                    signalInfo.faultExitThreshold != config.faultThreshold;
+            signalInfo.applied = true;
+            if (m_journalWriter && !rejournaling) {
+                m_journalWriter->appendSignal(signalInfo.handle.toValue(), signalInfo.signalId);
+            }
+            if (m_statsEnabled.load(std::memory_order_relaxed)) {
+                allocateSignalStats(signalInfo);
+            }
+            // 首次采样在下一次推进时间轮时进行；分组信号对齐到采样周期的整数倍，
+            // 使同组同周期的信号在同一刻度到期，一次批量取值即可覆盖
+            TimerWheel::Tick firstTick = toTick(signalInfo.registrationTime);
+            if (signalInfo.group) {
+                const auto period = static_cast<TimerWheel::Tick>(samplePeriodOf(signalInfo));
+                firstTick = (firstTick + period - 1) / period * period;
+            }
+            scheduleSignal(signalInfo, firstTick);
+        } else {
+            m_timerWheel.cancel(signalInfo.timerId);
+            signalInfo.timerId = TimerWheel::kInvalidTimer;
+            if (!resharding) {
+                --m_shardStats[signalInfo.shard].signalCount;
+            }
+            if (m_journalWriter) {
+                m_journalWriter->forgetSignal(signalInfo.handle.toValue());
+            }
+        }
+    }
+}
+
+bool ToleranceChecker::evaluatePushedSignals() {
+    {
+        std::lock_guard<std::mutex> pushLock(m_pushMutex);
+        m_pushedBatch.swap(m_pushedSignals);
+    }
+    
+    // 分片任务已全部结束，此处在监控线程上顺序评估，不会与周期检查并发
+    bool deferred = false;
+    for (auto& signalInfo : m_pushedBatch) {
+        if (signalInfo->removed.load()) {
+            signalInfo->pushQueued.store(false);
+            continue;
+        }
+        if (!signalInfo->applied) {
+            // 注册变更尚未应用（热存储槽位未就绪），留到下一轮
+            std::lock_guard<std::mutex> pushLock(m_pushMutex);
+            m_pushedSignals.push_back(signalInfo);
+            deferred = true;
+            continue;
+        }
+        signalInfo->pushQueued.store(false);
+        checkSignal(*signalInfo);
+    }
+    m_pushedBatch.clear();
+    return deferred;
+}
+
+bool ToleranceChecker::readPushedSample(const SignalInfo& signalInfo, double& value,
+                                        std::chrono::steady_clock::time_point& timestamp,
+                                        std::uint64_t& sequence) {
+    std::chrono::steady_clock::rep rawTime;
+    do {
+        sequence = signalInfo.pushSequence.load(std::memory_order_acquire);
+        if (sequence & 1u) {
+            continue;
+        }
+        value = signalInfo.pushedValue.load(std::memory_order_relaxed);
+        rawTime = signalInfo.pushedTime.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1u) || sequence != signalInfo.pushSequence.load(std::memory_order_relaxed));
+    
+    timestamp = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(rawTime));
+    return sequence != 0;
+}
+
+void ToleranceChecker::runShards() {
+    m_shardTasks.clear();
+    for (std::size_t shard = 0; shard < m_shardBuckets.size(); ++shard) {
+        if (!m_shardBuckets[shard].empty()) {
+            m_shardTasks.emplace_back([this, shard] { runShard(shard); });
+        }
+    }
+    
+    if (m_workerPool) {
+        m_workerPool->run(m_shardTasks);
+    } else {
+        for (auto& task : m_shardTasks) {
+            task();
+        }
+    }
+}
+
+void ToleranceChecker::runShard(std::size_t shard) {
+    auto& bucket = m_shardBuckets[shard];
+    auto& scratch = m_shardScratch[shard];
+    auto start = m_clock->now();
+    
+    // 1) 取样：值写入热存储，只收集需要分类的槽位；分组信号先按组归集
+    scratch.signals.clear();
+    scratch.slots.clear();
+    scratch.sampleTimes.clear();
+    TimerWheel::Tick earliestDue = TimerWheel::kNoExpiry;
+    for (SignalInfo* signalInfo : bucket) {
+        earliestDue = std::min(earliestDue, signalInfo->dueTick);
+        auto now = start;
+        double value = 0.0;
+        SampleStatus status = acquireSample(*signalInfo, value, now);
+        if (status == SampleStatus::READY && settled(*signalInfo, now)) {
+            m_hotStore.lastValue(signalInfo->handle.index) = value;
+            scratch.signals.push_back(signalInfo);
+            scratch.slots.push_back(signalInfo->handle.index);
+            scratch.sampleTimes.push_back(now);
+        } else if (status == SampleStatus::GROUP) {
+            auto inserted = scratch.groupIndex.emplace(signalInfo->group.get(), scratch.groupCount);
+            if (inserted.second) {
+                if (scratch.groupCount == scratch.groups.size()) {
+                    scratch.groups.emplace_back();
+                }
+                scratch.groups[scratch.groupCount++].group = signalInfo->group.get();
+            }
+            auto& batch = scratch.groups[inserted.first->second];
+            batch.signals.push_back(signalInfo);
+            batch.handles.push_back(signalInfo->handle);
+        }
+    }
+    fetchGroupSamples(scratch, start);
+    
+    // 2) 批量偏差分类
+    scratch.bands.resize(scratch.slots.size());
+    m_hotStore.classify(scratch.slots.data(), scratch.slots.size(), scratch.bands.data());
+    
+    // 3) 按分类结果推进状态机
+    for (std::size_t i = 0; i < scratch.signals.size(); ++i) {
+        SignalInfo& signalInfo = *scratch.signals[i];
+        updateSignalState(signalInfo, scratch.bands[i], m_hotStore.lastValue(signalInfo.handle.index),
+                          scratch.sampleTimes[i]);
+    }
+    
+    auto end = m_clock->now();
+    auto passUs = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+    auto dueTime = m_epoch + std::chrono::milliseconds(earliestDue);
+    std::uint64_t latenessUs = end > dueTime
+        ? static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - dueTime).count())
+        : 0;
+    
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    auto& stats = m_shardStats[shard];
+    ++stats.passes;
+    stats.checks += bucket.size();
+    stats.lastPassUs = passUs;
+    stats.maxPassUs = std::max(stats.maxPassUs, passUs);
+    stats.totalPassUs += passUs;
+    stats.maxLatenessUs = std::max(stats.maxLatenessUs, latenessUs);
+}
+
+std::size_t ToleranceChecker::shardOf(const SignalInfo& signalInfo) const {
+    const std::string& key = signalInfo.group ? signalInfo.group->groupId : signalInfo.signalId;
+    return std::hash<std::string>{}(key) % m_shardCount;
+}
+
+void ToleranceChecker::scheduleSignal(SignalInfo& signalInfo, TimerWheel::Tick dueTick) {
+    // 首次调度：计划刻度已过时在下一刻度采样，并以此作为采样网格的起点
+    TimerWheel::Tick current = m_timerWheel.currentTick();
+    if (dueTick <= current) {
+        dueTick = current + 1;
+    }
+    
+    signalInfo.dueTick = dueTick;
+    signalInfo.timerId = m_timerWheel.schedule(
+        dueTick, static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&signalInfo)));
+}
+
+void ToleranceChecker::rescheduleSignal(SignalInfo& signalInfo) {
+    // 按计划网格而非实际执行时间推进，避免采样周期随负载漂移
+    const auto period = static_cast<TimerWheel::Tick>(samplePeriodOf(signalInfo));
+    TimerWheel::Tick dueTick = signalInfo.dueTick + period;
+    TimerWheel::Tick current = m_timerWheel.currentTick();
+    if (dueTick <= current) {
+        ++m_passOverruns;
+        if (m_overrunPolicy.load(std::memory_order_relaxed) == OverrunPolicy::SKIP) {
+            // 跳到当前刻度之后的第一个网格点，保持采样相位
+            TimerWheel::Tick missed = (current - dueTick) / period + 1;
+            dueTick += missed * period;
+            m_passSkippedSamples += missed;
+        }
+        // CATCH_UP：保留网格点，时间轮会将其安排在下一个刻度，逐轮补采
+    }
+    
+    signalInfo.dueTick = dueTick;
+    signalInfo.timerId = m_timerWheel.schedule(
+        dueTick, static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&signalInfo)));
+}
+
+int ToleranceChecker::samplePeriodOf(const SignalInfo& signalInfo) const {
+    return signalInfo.config.samplePeriodMs > 0 ? signalInfo.config.samplePeriodMs : m_checkIntervalMs;
+}
+
+TimerWheel::Tick ToleranceChecker::toTick(std::chrono::steady_clock::time_point timePoint) const {
+    if (timePoint <= m_epoch) {
+        return 0;
+    }
+    return static_cast<TimerWheel::Tick>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(timePoint - m_epoch).count());
+}
+
+void ToleranceChecker::fetchGroupSamples(ShardScratch& scratch, std::chrono::steady_clock::time_point now) {
+    for (std::size_t g = 0; g < scratch.groupCount; ++g) {
+        auto& batch = scratch.groups[g];
+        batch.values.resize(batch.handles.size());
+        bool fetched = true;
+        const bool recordStats = m_statsEnabled.load(std::memory_order_relaxed);
+        const std::uint64_t fetchStart = recordStats ? CycleClock::now() : 0;
+        try {
+            batch.group->provider(batch.handles.data(), batch.values.data(), batch.handles.size());
+        } catch (const std::exception& e) {
+            TC_LOG_ERROR("获取信号组 %s 的值时发生错误: %s", batch.group->groupId.c_str(), e.what());
+            fetched = false;
+        }
+        if (recordStats) {
+            m_groupFetchLatency.record(CycleClock::toNs(CycleClock::now() - fetchStart));
+        }
+        
+        for (std::size_t i = 0; fetched && i < batch.signals.size(); ++i) {
+            SignalInfo* signalInfo = batch.signals[i];
+            if (settled(*signalInfo, now)) {
+                m_hotStore.lastValue(signalInfo->handle.index) = batch.values[i];
+                scratch.signals.push_back(signalInfo);
+                scratch.slots.push_back(signalInfo->handle.index);
+                scratch.sampleTimes.push_back(now);
+            }
+        }
+        batch.group = nullptr;
+        batch.signals.clear();
+        batch.handles.clear();
+    }
+    scratch.groupCount = 0;
+    scratch.groupIndex.clear();
+}
+
+void ToleranceChecker::checkSignal(SignalInfo& sig) {
+    auto now = m_clock->now();
     double currentValue = 0.0;
-    try {
-        currentValue = sig.config.valueCallback(signalId);
-    } catch (const std::exception& e) {
-        std::cerr << "获取信号 " << signalId << " 的值时发生错误: " << e.what() << std::endl;
+    // 分组信号没有新推送样本时等待下一次周期检查批量取值
+    if (acquireSample(sig, currentValue, now) != SampleStatus::READY || !settled(sig, now)) {
         return;
     }
     
+    const std::uint32_t slot = sig.handle.index;
+    m_hotStore.lastValue(slot) = currentValue;
+    std::uint8_t band = 0;
+    m_hotStore.classify(&slot, 1, &band);
+    updateSignalState(sig, band, currentValue, now);
+}
+
+ToleranceChecker::SampleStatus ToleranceChecker::acquireSample(SignalInfo& sig, double& currentValue,
+                                                              std::chrono::steady_clock::time_point& now) {
+    const std::string& signalId = sig.signalId;
+    
+    // 获取当前信号值：优先使用推送的新样本，其次共享内存槽位与信号组批量取值，最后轮询valueCallback
+    std::chrono::steady_clock::time_point sampleTime;
+    std::uint64_t sequence = 0;
+    bool pushed = readPushedSample(sig, currentValue, sampleTime, sequence);
+    if (pushed && sequence != sig.consumedSequence) {
+        sig.consumedSequence = sequence;
+        now = sampleTime;  // 以样本的源时间戳推进计时
+    } else if (m_replayMode.load(std::memory_order_relaxed) &&
+               (sig.config.sharedSegment || sig.group || sig.config.valueCallback)) {
+        return SampleStatus::NONE;  // 回放时实时数据源的信号只评估录制的样本
+    } else if (sig.config.sharedSegment) {
+        // 直接读取生产者进程写入的槽位；没有新样本时沿用最近的值推进计时
+        SharedSample sample;
+        if (!sig.config.sharedSegment->read(sig.config.sharedSlot, sample)) {
+            return SampleStatus::NONE;  // 生产者尚未写入或正在写入
+        }
+        currentValue = sample.value;
+        if (sample.sequence != sig.sharedSequence) {
+            sig.sharedSequence = sample.sequence;
+            now = sample.timestamp;
+        }
+    } else if (sig.group) {
+        return SampleStatus::GROUP;
+    } else if (sig.config.valueCallback) {
+        SignalStatsBlock* stats = m_statsEnabled.load(std::memory_order_relaxed)
+            ? sig.stats.load(std::memory_order_relaxed) : nullptr;
+        const std::uint64_t callStart = stats ? CycleClock::now() : 0;
+        try {
+            currentValue = sig.config.valueCallback(signalId);
+        } catch (const std::exception& e) {
+            TC_LOG_ERROR("获取信号 %s 的值时发生错误: %s", signalId.c_str(), e.what());
+            if (stats) {
+                bump(stats->valueErrors);
+            }
+            return SampleStatus::NONE;
+        }
+        if (stats) {
+            stats->valueLatency.recordExclusive(CycleClock::toNs(CycleClock::now() - callStart));
+        }
+    } else if (!pushed) {
+        return SampleStatus::NONE;  // 纯推送信号尚未收到样本
+    }
+    return SampleStatus::READY;
+}
+
+bool ToleranceChecker::settled(const SignalInfo& sig, std::chrono::steady_clock::time_point now) const {
     // 检查tc等待期
     auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
         now - sig.registrationTime).count();
     if (elapsedMs < sig.config.tcMs) {
-        return;  // 仍在等待期
+        return false;  // 仍在等待期
     }
     // 首次过等待期时输出日志
-    if (sig.state == SignalState::UNKNOWN && elapsedMs >= sig.config.tcMs) {
-        std::cout << "信号 " << signalId << " tc等待期结束，开始监控" << std::endl;
+    if (sig.state == SignalState::UNKNOWN) {
+        TC_LOG_INFO("信号 %s tc等待期结束，开始监控", sig.signalId.c_str());
     }
+    return true;
+}
 
-    // 计算偏差值（当前值与目标值的差的绝对值）
-    double deviation = std::abs(currentValue - sig.config.targetValue);
+void ToleranceChecker::updateSignalState(SignalInfo& sig, std::uint8_t band, double currentValue,
+                                         std::chrono::steady_clock::time_point now) {
+    const SignalState previous = sig.state.load(std::memory_order_relaxed);
+    SignalState current = previous;
+    
+    // 先记录样本，回调中查看历史时包含触发回调的样本
+    if (sig.history) {
+        sig.history->record(now, currentValue);
+    }
     
     // 1) 信号处于正常状态
-    if (deviation <= sig.config.warningThreshold) {
-        sig.state = SignalState::NORMAL;
+    if (band == static_cast<std::uint8_t>(SignalState::NORMAL)) {
+        current = SignalState::NORMAL;
         sig.warningTimerActive = sig.faultTimerActive = false;
-        return;
     }
     
     // 2) 信号处于警告状态
-    if (deviation <= sig.config.faultThreshold) {
+    else if (band == static_cast<std::uint8_t>(SignalState::WARNING)) {
         sig.faultTimerActive = false;
         if (!sig.warningTimerActive) {
             sig.warningTimerActive = true;
@@ -136,9 +1532,9 @@ void ToleranceChecker::checkSignal(const std::string& signalId, SignalInfo& sig)
         }
         if (std::chrono::duration_cast<std::chrono::milliseconds>(now - sig.warningStartTime).count()
             >= sig.config.tsMs) {
-            if (sig.state != SignalState::WARNING && sig.config.warningCallback)
-                sig.config.warningCallback(signalId, currentValue);
-            sig.state = SignalState::WARNING;
+            if (previous != SignalState::WARNING && sig.config.warningCallback)
+                m_dispatcher.dispatch(sig, SignalState::WARNING, currentValue);
+            current = SignalState::WARNING;
         }
     }
 
@@ -150,10 +1546,117 @@ void ToleranceChecker::checkSignal(const std::string& signalId, SignalInfo& sig)
         }
         if (std::chrono::duration_cast<std::chrono::milliseconds>(now - sig.faultStartTime).count()
             >= sig.config.tsMs) {
-            if (sig.state != SignalState::FAULT && sig.config.faultCallback)
-                sig.config.faultCallback(signalId, currentValue);
-            sig.state = SignalState::FAULT;
+            if (previous != SignalState::FAULT && sig.config.faultCallback)
+                m_dispatcher.dispatch(sig, SignalState::FAULT, currentValue);
+            current = SignalState::FAULT;
         }
     }
+    
+    // 滞回：按确认后的状态选择分类阈值。真正进入WARNING/FAULT后才改用退出阈值，
+    // 偏差回落到退出阈值以内才离开该状态；尚在ts计时中的越限样本不改变阈值
+    if (sig.hysteresis && current != previous) {
+        const bool warned = current == SignalState::WARNING || current == SignalState::FAULT;
+        m_hotStore.setBandThresholds(sig.handle.index,
+            warned ? sig.warningExitThreshold : sig.config.warningThreshold,
+            current == SignalState::FAULT ? sig.faultExitThreshold : sig.config.faultThreshold);
+    }
+    
+    // 状态、最近值与进入时间在顺序锁内一起发布，批量查询读到的三者来自同一次检查
+    const std::uint64_t sequence = sig.statusSequence.load(std::memory_order_relaxed);
+    sig.statusSequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    sig.state.store(current, std::memory_order_relaxed);
+    sig.lastValue.store(currentValue, std::memory_order_relaxed);
+    if (current != previous) {
+        sig.stateSince.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+    sig.statusSequence.store(sequence + 2, std::memory_order_release);
+    
+    m_hotStore.state(sig.handle.index) = static_cast<std::uint8_t>(current);
+    
+    if (current != previous && (m_transitionWriter || m_journalWriter ||
+                                  m_batchSinkEnabled.load(std::memory_order_relaxed))) {
+        m_shardScratch[sig.shard].transitions.push_back(
+            TransitionEvent{0, sig.handle, previous, current, currentValue, now, {}});
+    }
+    if (m_journalSamples) {
+        auto& scratch = m_shardScratch[sig.shard];
+        scratch.journalSamples.push_back(HistorySample{now, currentValue});
+        scratch.journalHandles.push_back(sig.handle);
+    }
+    
+    SignalStatsBlock* stats = m_statsEnabled.load(std::memory_order_relaxed)
+        ? sig.stats.load(std::memory_order_relaxed) : nullptr;
+    if (stats) {
+        bump(stats->samples);
+        if (current != previous) {
+            if (current == SignalState::WARNING) {
+                bump(stats->warningTransitions);
+            } else if (current == SignalState::FAULT) {
+                bump(stats->faultTransitions);
+            } else if (previous == SignalState::WARNING || previous == SignalState::FAULT) {
+                bump(stats->recoveries);
+            }
+        }
+    }
+}
 
-}
\ No newline at end of file
+void ToleranceChecker::publishTransitions() {
+    // 监控线程是批量回调唯一的生产者；持有引用期间设置线程等待，不在监控线程上析构旧合并器。
+    // 追加与移交在锁外进行，BLOCK策略下等待队列空位时不阻塞统计查询
+    auto batchSink = acquireBatchSink();
+    if (!m_transitionWriter && !m_journalWriter && !batchSink) {
+        // 批量回调可能在本轮收集迁移之后才停用
+        for (auto& scratch : m_shardScratch) {
+            scratch.transitions.clear();
+        }
+        return;
+    }
+    const auto publishTime = m_clock->now();
+    for (auto& scratch : m_shardScratch) {
+        for (TransitionEvent& event : scratch.transitions) {
+            event.publishTime = publishTime;
+            if (m_transitionWriter) {
+                event.sequence = m_transitionWriter->nextSequence();
+                m_transitionWriter->publish(event);
+            }
+            if (m_journalWriter) {
+                m_journalWriter->appendTransition(event.handle.toValue(), static_cast<std::uint8_t>(event.oldState),
+                                                  static_cast<std::uint8_t>(event.newState), event.value,
+                                                  event.sampleTime);
+            }
+            if (batchSink) {
+                batchSink->append(event, publishTime);
+            }
+        }
+        scratch.transitions.clear();
+        
+        for (std::size_t i = 0; m_journalWriter && i < scratch.journalSamples.size(); ++i) {
+            m_journalWriter->appendSample(scratch.journalHandles[i].toValue(), scratch.journalSamples[i].value,
+                                          scratch.journalSamples[i].timestamp);
+        }
+        scratch.journalSamples.clear();
+        scratch.journalHandles.clear();
+    }
+    
+    // 本轮的迁移已全部并入当前批次：未设置合并窗口时立即移交，否则等窗口到期
+    if (batchSink) {
+        batchSink->poll(publishTime);
+    }
+    releaseBatchSink(batchSink);
+}
+
+void ToleranceChecker::journalSignals(const SignalTable& table) {
+    for (const auto& signalInfo : table.slots) {
+        if (signalInfo) {
+            m_journalWriter->appendSignal(signalInfo->handle.toValue(), signalInfo->signalId);
+        }
+    }
+}
+
+void ToleranceChecker::allocateSignalStats(SignalInfo& signalInfo) {
+    if (!signalInfo.statsStorage) {
+        signalInfo.statsStorage = std::make_unique<SignalStatsBlock>();
+        signalInfo.stats.store(signalInfo.statsStorage.get(), std::memory_order_release);
+    }
+}
@@ -1,7 +1,22 @@
 #include "ToleranceChecker_c.h"
 #include "ToleranceChecker.h"
+#include "ToleranceKernel.h"
+#include <cstring>
 #include <string>
+#include <vector>
 #include <exception>
+#include <chrono>
+#include <algorithm>
+
+// 不透明实例句柄的实际定义
+struct tc_checker {
+    explicit tc_checker(int default_sample_period_ms) : instance(default_sample_period_ms) {}
+    ToleranceChecker instance;
+};
+
+struct tc_kernel {
+    ToleranceKernel kernel;
+};
 
 // 将 C 回调函数转换为 C++ std::function
 static WarningCallback wrap_warning_callback(tc_warning_callback_t c_callback, void* context) {
@@ -25,6 +40,18 @@ static ValueCallback wrap_value_callback(tc_value_callback_t c_callback, void* c
     };
 }
 
+static BatchValueProvider wrap_batch_value_callback(tc_batch_value_callback_t c_callback, void* context) {
+    return [c_callback, context](const SignalHandle* handles, double* values, std::size_t count) {
+        // 每个检查线程复用自己的句柄转换缓冲区
+        thread_local std::vector<tc_handle_t> c_handles;
+        c_handles.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            c_handles[i] = handles[i].toValue();
+        }
+        c_callback(c_handles.data(), values, count, context);
+    };
+}
+
 // 将 C 信号状态转换为 C++ 信号状态
 static SignalState convert_to_cpp_state(tc_signal_state_t c_state) {
     switch (c_state) {
@@ -47,41 +74,305 @@ static tc_signal_state_t convert_to_c_state(SignalState cpp_state) {
     }
 }
 
+// 配置是否由与本库相同版本的 tc_signal_config_init() 初始化
+static bool valid_config(const tc_signal_config_t* config) {
+    return config->struct_size == sizeof(tc_signal_config_t);
+}
+
+// 将 C 配置转换为 C++ 配置（调用前须以 valid_config() 检查）
+static SignalConfig convert_config(const tc_signal_config_t* config) {
+    SignalConfig cpp_config;
+    cpp_config.targetValue = config->target_value;
+    cpp_config.warningThreshold = config->warning_threshold;
+    cpp_config.faultThreshold = config->fault_threshold;
+    cpp_config.warningCallback = wrap_warning_callback(config->warning_callback, config->context);
+    cpp_config.faultCallback = wrap_fault_callback(config->fault_callback, config->context);
+    cpp_config.valueCallback = wrap_value_callback(config->value_callback, config->context);
+    cpp_config.tcMs = config->tc_ms;
+    cpp_config.tsMs = config->ts_ms;
+    cpp_config.samplePeriodMs = config->sample_period_ms;
+    if (config->group_id) {
+        cpp_config.groupId = config->group_id;
+    }
+    if (config->shared_segment) {
+        cpp_config.sharedSegment = config->shared_segment->segment;
+        cpp_config.sharedSlot = config->shared_slot;
+    }
+    cpp_config.historyDepth = config->history_depth;
+    cpp_config.warningExitThreshold = config->warning_exit_threshold;
+    cpp_config.faultExitThreshold = config->fault_exit_threshold;
+    return cpp_config;
+}
+
+// 将 C 时间戳转换为 steady_clock 时间点（steady_clock 在 POSIX 平台上即 CLOCK_MONOTONIC），
+// 0 转换为零值时间点，由监控器取其时钟的当前时间
+static std::chrono::steady_clock::time_point convert_timestamp(long long timestamp_ns) {
+    return std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timestamp_ns));
+}
+
+static PushMode convert_push_mode(tc_push_mode_t mode) {
+    return mode == TC_PUSH_NEXT_TICK ? PushMode::NEXT_TICK : PushMode::IMMEDIATE;
+}
+
+static void convert_histogram(const HistogramSummary& summary, tc_histogram_t* histogram) {
+    histogram->count = summary.count;
+    histogram->mean_ns = summary.meanNs;
+    histogram->max_ns = summary.maxNs;
+    histogram->p50_ns = summary.p50Ns;
+    histogram->p90_ns = summary.p90Ns;
+    histogram->p99_ns = summary.p99Ns;
+    histogram->p999_ns = summary.p999Ns;
+}
+
+static void convert_status(const SignalStatus& status, tc_signal_status_t* c_status) {
+    c_status->handle = status.handle.toValue();
+    c_status->state = convert_to_c_state(status.state);
+    c_status->last_value = status.lastValue;
+    c_status->since_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        status.since.time_since_epoch()).count();
+}
+
+static void convert_transition(const TransitionEvent& event, tc_transition_event_t* c_event) {
+    c_event->sequence = event.sequence;
+    c_event->handle = event.handle.toValue();
+    c_event->old_state = convert_to_c_state(event.oldState);
+    c_event->new_state = convert_to_c_state(event.newState);
+    c_event->value = event.value;
+    c_event->sample_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        event.sampleTime.time_since_epoch()).count();
+    c_event->publish_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        event.publishTime.time_since_epoch()).count();
+}
+
+static ToleranceChecker& resolve_checker(tc_checker_t* checker) {
+    return checker ? checker->instance : ToleranceChecker::getInstance();
+}
+
 // API 函数实现
 
-int tc_register_signal(const char* signal_id, const tc_signal_config_t* config) {
-    if (!signal_id || !config) {
+void tc_signal_config_init(tc_signal_config_t* config) {
+    if (!config) {
+        return;
+    }
+    std::memset(config, 0, sizeof(*config));
+    config->struct_size = sizeof(tc_signal_config_t);
+}
+
+tc_checker_t* tc_checker_create(int default_sample_period_ms) {
+    try {
+        return new tc_checker(default_sample_period_ms);
+        
+    } catch (const std::exception& e) {
+        return nullptr;
+    }
+}
+
+void tc_checker_destroy(tc_checker_t* checker) {
+    delete checker;
+}
+
+int tc_checker_start_monitoring(tc_checker_t* checker) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.startMonitoring();
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_set_cpu_affinity(tc_checker_t* checker, const unsigned* cpus, size_t count) {
+    if (count > 0 && !cpus) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.setCpuAffinity(std::vector<unsigned>(cpus, cpus + count));
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_configure_realtime(tc_checker_t* checker, const tc_realtime_config_t* config) {
+    if (!config || (config->cpu_count > 0 && !config->cpus)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        RealtimeConfig cpp_config;
+        cpp_config.policy = static_cast<SchedulingPolicy>(config->policy);
+        cpp_config.priority = config->priority;
+        cpp_config.cpus.assign(config->cpus, config->cpus + config->cpu_count);
+        cpp_config.lockMemory = config->lock_memory != 0;
+        cpp_config.prefaultStackBytes = config->prefault_stack_bytes;
+        cpp_checker.configureRealtime(cpp_config);
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_realtime_report(tc_checker_t* checker, tc_realtime_report_t* report) {
+    if (!report) {
         return TC_ERROR_NULL_PTR;
     }
     
     try {
-        // 创建 C++ 配置
-        SignalConfig cpp_config;
-        cpp_config.targetValue = config->target_value;
-        cpp_config.warningThreshold = config->warning_threshold;
-        cpp_config.faultThreshold = config->fault_threshold;
-        cpp_config.warningCallback = wrap_warning_callback(config->warning_callback, config->context);
-        cpp_config.faultCallback = wrap_fault_callback(config->fault_callback, config->context);
-        cpp_config.valueCallback = wrap_value_callback(config->value_callback, config->context);
-        cpp_config.tcMs = config->tc_ms;
-        cpp_config.tsMs = config->ts_ms;
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        RealtimeReport cpp_report = cpp_checker.getRealtimeReport();
+        
+        report->applied = cpp_report.applied ? 1 : 0;
+        report->policy = static_cast<tc_sched_policy_t>(cpp_report.policy);
+        report->priority = cpp_report.priority;
+        report->scheduling_error = cpp_report.schedulingError;
+        report->cpu_count = std::min<size_t>(cpp_report.cpus.size(), TC_REALTIME_MAX_CPUS);
+        for (size_t i = 0; i < report->cpu_count; ++i) {
+            report->cpus[i] = cpp_report.cpus[i];
+        }
+        report->affinity_error = cpp_report.affinityError;
+        report->memory_locked = cpp_report.memoryLocked ? 1 : 0;
+        report->memory_lock_error = cpp_report.memoryLockError;
+        report->stack_prefaulted = cpp_report.stackPrefaulted;
+        return TC_SUCCESS;
         
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+
+int tc_checker_register_signal(tc_checker_t* checker, const char* signal_id,
+                               const tc_signal_config_t* config) {
+    return tc_checker_register_signal_with_handle(checker, signal_id, config, nullptr);
+}
+
+int tc_checker_register_signal_with_handle(tc_checker_t* checker, const char* signal_id,
+                                           const tc_signal_config_t* config, tc_handle_t* handle) {
+    if (!signal_id || !config) {
+        return TC_ERROR_NULL_PTR;
+    }
+    if (!valid_config(config)) {
+        return TC_ERROR_INVALID_PARAM;
+    }
+    
+    try {
         // 注册信号
         std::string signal_key(signal_id);
-        auto& checker = ToleranceChecker::getInstance();
-        bool success = checker.registerSignal(signal_key, cpp_config);
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        if (config->group_id && !cpp_checker.isSignalGroupRegistered(config->group_id)) {
+            return TC_ERROR_NOT_FOUND;
+        }
+        SignalHandle cpp_handle = cpp_checker.registerSignal(signal_key, convert_config(config));
         
-        return success ? TC_SUCCESS : TC_ERROR_EXISTS;
+        if (handle) {
+            *handle = cpp_handle.toValue();
+        }
+        return cpp_handle ? TC_SUCCESS : TC_ERROR_EXISTS;
         
     } catch (const std::exception& e) {
         return TC_ERROR_GENERAL;
     }
 }
 
-int tc_stop_monitoring(void) {
+int tc_checker_register_signals(tc_checker_t* checker, const char* const* signal_ids,
+                                const tc_signal_config_t* configs, size_t count, tc_handle_t* handles,
+                                size_t* registered) {
+    if (count > 0 && (!signal_ids || !configs)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!valid_config(&configs[i])) {
+            return TC_ERROR_INVALID_PARAM;
+        }
+    }
+    
+    try {
+        std::vector<SignalRegistration> signals;
+        signals.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!signal_ids[i]) {
+                return TC_ERROR_NULL_PTR;
+            }
+            signals.emplace_back(signal_ids[i], convert_config(&configs[i]));
+        }
+        
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        std::vector<SignalHandle> cpp_handles = cpp_checker.registerSignals(signals);
+        
+        size_t succeeded = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (handles) {
+                handles[i] = cpp_handles[i].toValue();
+            }
+            succeeded += cpp_handles[i] ? 1 : 0;
+        }
+        if (registered) {
+            *registered = succeeded;
+        }
+        return succeeded == count ? TC_SUCCESS : TC_ERROR_EXISTS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_find_signal(tc_checker_t* checker, const char* signal_id, tc_handle_t* handle) {
+    if (!signal_id || !handle) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        SignalHandle cpp_handle = cpp_checker.findSignal(signal_id);
+        
+        *handle = cpp_handle.toValue();
+        return cpp_handle ? TC_SUCCESS : TC_ERROR_NOT_FOUND;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_register_signal_group(tc_checker_t* checker, const char* group_id,
+                                     tc_batch_value_callback_t callback, void* ctx) {
+    if (!group_id || !callback) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        return cpp_checker.registerSignalGroup(group_id, wrap_batch_value_callback(callback, ctx))
+            ? TC_SUCCESS : TC_ERROR_EXISTS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_remove_signal_group(tc_checker_t* checker, const char* group_id) {
+    if (!group_id) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
     try {
-        auto& checker = ToleranceChecker::getInstance();
-        checker.stopMonitoring();
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        return cpp_checker.removeSignalGroup(group_id) ? TC_SUCCESS : TC_ERROR_NOT_FOUND;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_stop_monitoring(tc_checker_t* checker) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.stopMonitoring();
         return TC_SUCCESS;
         
     } catch (const std::exception& e) {
@@ -89,25 +380,25 @@ int tc_stop_monitoring(void) {
     }
 }
 
-int tc_is_monitoring(void) {
+int tc_checker_is_monitoring(tc_checker_t* checker) {
     try {
-        auto& checker = ToleranceChecker::getInstance();
-        return checker.isMonitoring() ? 1 : 0;
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        return cpp_checker.isMonitoring() ? 1 : 0;
         
     } catch (const std::exception& e) {
         return 0;
     }
 }
 
-int tc_remove_signal(const char* signal_id) {
+int tc_checker_remove_signal(tc_checker_t* checker, const char* signal_id) {
     if (!signal_id) {
         return TC_ERROR_NULL_PTR;
     }
     
     try {
         std::string signal_key(signal_id);
-        auto& checker = ToleranceChecker::getInstance();
-        checker.removeSignal(signal_key);
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.removeSignal(signal_key);
         
         return TC_SUCCESS;
         
@@ -116,15 +407,50 @@ int tc_remove_signal(const char* signal_id) {
     }
 }
 
-int tc_get_signal_state(const char* signal_id, tc_signal_state_t* state) {
+int tc_checker_remove_signal_by_handle(tc_checker_t* checker, tc_handle_t handle) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        return cpp_checker.removeSignal(SignalHandle::fromValue(handle)) ? TC_SUCCESS : TC_ERROR_NOT_FOUND;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_remove_signals(tc_checker_t* checker, const tc_handle_t* handles, size_t count,
+                              size_t* removed) {
+    if (count > 0 && !handles) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        std::vector<SignalHandle> cpp_handles;
+        cpp_handles.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            cpp_handles.push_back(SignalHandle::fromValue(handles[i]));
+        }
+        
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        size_t succeeded = cpp_checker.removeSignals(cpp_handles);
+        if (removed) {
+            *removed = succeeded;
+        }
+        return succeeded == count ? TC_SUCCESS : TC_ERROR_NOT_FOUND;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_signal_state(tc_checker_t* checker, const char* signal_id, tc_signal_state_t* state) {
     if (!signal_id || !state) {
         return TC_ERROR_NULL_PTR;
     }
     
     try {
         std::string signal_key(signal_id);
-        auto& checker = ToleranceChecker::getInstance();
-        SignalState cpp_state = checker.getSignalState(signal_key);
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        SignalState cpp_state = cpp_checker.getSignalState(signal_key);
         
         *state = convert_to_c_state(cpp_state);
         return TC_SUCCESS;
@@ -134,6 +460,772 @@ int tc_get_signal_state(const char* signal_id, tc_signal_state_t* state) {
     }
 }
 
+int tc_checker_get_signal_state_by_handle(tc_checker_t* checker, tc_handle_t handle,
+                                          tc_signal_state_t* state) {
+    if (!state) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        SignalHandle cpp_handle = SignalHandle::fromValue(handle);
+        if (!cpp_checker.isRegistered(cpp_handle)) {
+            return TC_ERROR_NOT_FOUND;
+        }
+        
+        *state = convert_to_c_state(cpp_checker.getSignalState(cpp_handle));
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_signal_states(tc_checker_t* checker, tc_signal_status_t* states, size_t capacity,
+                                 size_t* count) {
+    if (!count || (capacity > 0 && !states)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        // 每个调用线程复用自己的转换缓冲区
+        thread_local std::vector<SignalStatus> cpp_states;
+        cpp_states.resize(capacity);
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        size_t total = cpp_checker.getSignalStates(cpp_states.data(), capacity);
+        
+        size_t written = total < capacity ? total : capacity;
+        for (size_t i = 0; i < written; ++i) {
+            convert_status(cpp_states[i], &states[i]);
+        }
+        *count = total;
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_signal_states_by_handle(tc_checker_t* checker, const tc_handle_t* handles, size_t count,
+                                           tc_signal_status_t* states) {
+    if (count > 0 && (!handles || !states)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        thread_local std::vector<SignalHandle> cpp_handles;
+        thread_local std::vector<SignalStatus> cpp_states;
+        cpp_handles.resize(count);
+        cpp_states.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            cpp_handles[i] = SignalHandle::fromValue(handles[i]);
+        }
+        
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        size_t found = cpp_checker.getSignalStates(cpp_handles.data(), count, cpp_states.data());
+        for (size_t i = 0; i < count; ++i) {
+            convert_status(cpp_states[i], &states[i]);
+        }
+        return found == count ? TC_SUCCESS : TC_ERROR_NOT_FOUND;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_export_sample_history(tc_checker_t* checker, tc_handle_t handle, tc_history_sample_t* samples,
+                                     size_t capacity, size_t* count) {
+    if (!count || (capacity > 0 && !samples)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        SignalHandle cpp_handle = SignalHandle::fromValue(handle);
+        SignalStatus cpp_status;
+        if (cpp_checker.getSignalStates(&cpp_handle, 1, &cpp_status) == 0) {
+            *count = 0;
+            return TC_ERROR_NOT_FOUND;
+        }
+        
+        thread_local std::vector<HistorySample> cpp_samples;
+        cpp_samples.resize(capacity);
+        *count = cpp_checker.exportSampleHistory(cpp_handle, cpp_samples.data(), capacity);
+        for (size_t i = 0; i < *count; ++i) {
+            samples[i].timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                cpp_samples[i].timestamp.time_since_epoch()).count();
+            samples[i].value = cpp_samples[i].value;
+        }
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_set_history_memory_limit(tc_checker_t* checker, size_t bytes) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.setHistoryMemoryLimit(bytes);
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_history_memory(tc_checker_t* checker, tc_history_memory_t* usage) {
+    if (!usage) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        HistoryMemoryUsage cpp_usage = cpp_checker.getHistoryMemoryUsage();
+        usage->limit_bytes = cpp_usage.limitBytes;
+        usage->used_bytes = cpp_usage.usedBytes;
+        usage->signal_count = cpp_usage.signalCount;
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_push_value(tc_checker_t* checker, const char* signal_id, double value, long long timestamp_ns,
+                          tc_push_mode_t mode) {
+    if (!signal_id) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        std::string signal_key(signal_id);
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        bool found = cpp_checker.pushValue(signal_key, value, convert_timestamp(timestamp_ns), convert_push_mode(mode));
+        
+        return found ? TC_SUCCESS : TC_ERROR_NOT_FOUND;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_push_value_by_handle(tc_checker_t* checker, tc_handle_t handle, double value,
+                                    long long timestamp_ns, tc_push_mode_t mode) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        bool found = cpp_checker.pushValue(SignalHandle::fromValue(handle), value,
+                                           convert_timestamp(timestamp_ns), convert_push_mode(mode));
+        
+        return found ? TC_SUCCESS : TC_ERROR_NOT_FOUND;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_configure_sharding(tc_checker_t* checker, unsigned worker_count, unsigned shard_count) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.configureSharding(worker_count, shard_count);
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_shard_stats(tc_checker_t* checker, tc_shard_stats_t* stats, int capacity, int* count) {
+    if (!count || (!stats && capacity > 0)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        std::vector<ShardStats> cpp_stats = cpp_checker.getShardStats();
+        
+        *count = static_cast<int>(cpp_stats.size());
+        for (int i = 0; i < capacity && i < *count; ++i) {
+            const ShardStats& src = cpp_stats[i];
+            stats[i].signal_count = src.signalCount;
+            stats[i].passes = src.passes;
+            stats[i].checks = src.checks;
+            stats[i].last_pass_us = src.lastPassUs;
+            stats[i].max_pass_us = src.maxPassUs;
+            stats[i].total_pass_us = src.totalPassUs;
+            stats[i].max_lateness_us = src.maxLatenessUs;
+        }
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_configure_dispatch(tc_checker_t* checker, unsigned thread_count, unsigned queue_capacity,
+                                  tc_overflow_policy_t policy) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.configureDispatch(thread_count, queue_capacity,
+                                      policy == TC_OVERFLOW_BLOCK ? OverflowPolicy::BLOCK : OverflowPolicy::DROP);
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_dispatch_stats(tc_checker_t* checker, tc_dispatch_stats_t* stats) {
+    if (!stats) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        DispatchStats cpp_stats = cpp_checker.getDispatchStats();
+        
+        stats->submitted = cpp_stats.submitted;
+        stats->delivered = cpp_stats.delivered;
+        stats->dropped = cpp_stats.dropped;
+        stats->blocked = cpp_stats.blocked;
+        stats->exceptions = cpp_stats.exceptions;
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_set_overrun_policy(tc_checker_t* checker, tc_overrun_policy_t policy) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.setOverrunPolicy(policy == TC_OVERRUN_CATCH_UP ? OverrunPolicy::CATCH_UP : OverrunPolicy::SKIP);
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_loop_stats(tc_checker_t* checker, tc_loop_stats_t* stats) {
+    if (!stats) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        LoopStats cpp_stats = cpp_checker.getLoopStats();
+        
+        stats->iterations = cpp_stats.iterations;
+        stats->timed_wakeups = cpp_stats.timedWakeups;
+        stats->last_jitter_us = cpp_stats.lastJitterUs;
+        stats->max_jitter_us = cpp_stats.maxJitterUs;
+        stats->total_jitter_us = cpp_stats.totalJitterUs;
+        stats->overruns = cpp_stats.overruns;
+        stats->skipped_samples = cpp_stats.skippedSamples;
+        stats->worst_lateness_us = cpp_stats.worstLatenessUs;
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_enable_stats(tc_checker_t* checker, int enabled) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.enableStats(enabled != 0);
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_stats(tc_checker_t* checker, tc_stats_t* stats) {
+    if (!stats) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        CheckerStats cpp_stats = cpp_checker.getStats();
+        
+        stats->enabled = cpp_stats.enabled ? 1 : 0;
+        convert_histogram(cpp_stats.passLatency, &stats->pass_latency);
+        convert_histogram(cpp_stats.lockHold, &stats->lock_hold);
+        convert_histogram(cpp_stats.wakeJitter, &stats->wake_jitter);
+        convert_histogram(cpp_stats.groupFetchLatency, &stats->group_fetch_latency);
+        stats->samples = cpp_stats.samples;
+        stats->warning_transitions = cpp_stats.warningTransitions;
+        stats->fault_transitions = cpp_stats.faultTransitions;
+        stats->recoveries = cpp_stats.recoveries;
+        stats->value_errors = cpp_stats.valueErrors;
+        stats->callback_exceptions = cpp_stats.callbackExceptions;
+        stats->overruns = cpp_stats.overruns;
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_signal_stats(tc_checker_t* checker, tc_handle_t handle, tc_signal_stats_t* stats) {
+    if (!stats) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        SignalStats cpp_stats;
+        if (!cpp_checker.getSignalStats(SignalHandle::fromValue(handle), cpp_stats)) {
+            return TC_ERROR_NOT_FOUND;
+        }
+        
+        convert_histogram(cpp_stats.valueLatency, &stats->value_latency);
+        stats->samples = cpp_stats.samples;
+        stats->warning_transitions = cpp_stats.warningTransitions;
+        stats->fault_transitions = cpp_stats.faultTransitions;
+        stats->recoveries = cpp_stats.recoveries;
+        stats->value_errors = cpp_stats.valueErrors;
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_enable_transition_stream(tc_checker_t* checker, size_t capacity) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.enableTransitionStream(capacity);
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_subscribe_transitions(tc_checker_t* checker, unsigned long long* cursor) {
+    if (!cursor) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        *cursor = cpp_checker.subscribeTransitions();
+        return *cursor != 0 ? TC_SUCCESS : TC_ERROR_MONITORING;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_read_transitions(tc_checker_t* checker, unsigned long long* cursor,
+                                tc_transition_event_t* events, size_t capacity, size_t* count) {
+    if (!cursor || !count || (capacity > 0 && !events)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        // 每个调用线程复用自己的转换缓冲区
+        thread_local std::vector<TransitionEvent> cpp_events;
+        cpp_events.resize(capacity);
+        std::uint64_t cpp_cursor = *cursor;
+        std::size_t read = 0;
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        TransitionReadStatus status = cpp_checker.readTransitions(cpp_cursor, cpp_events.data(), capacity, read);
+        
+        for (size_t i = 0; i < read; ++i) {
+            convert_transition(cpp_events[i], &events[i]);
+        }
+        *cursor = cpp_cursor;
+        *count = read;
+        
+        switch (status) {
+            case TransitionReadStatus::OK: return TC_SUCCESS;
+            case TransitionReadStatus::OVERRUN: return TC_ERROR_OVERRUN;
+            default: return TC_ERROR_MONITORING;
+        }
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_resync_transitions(tc_checker_t* checker, unsigned long long* cursor,
+                                  tc_signal_status_t* states, size_t capacity, size_t* count) {
+    if (!cursor || !count || (capacity > 0 && !states)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        thread_local std::vector<SignalStatus> cpp_states;
+        cpp_states.resize(capacity);
+        std::size_t total = 0;
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        *cursor = cpp_checker.resyncTransitions(cpp_states.data(), capacity, total);
+        
+        size_t written = total < capacity ? total : capacity;
+        for (size_t i = 0; i < written; ++i) {
+            convert_status(cpp_states[i], &states[i]);
+        }
+        *count = total;
+        return *cursor != 0 ? TC_SUCCESS : TC_ERROR_MONITORING;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_enable_journal(tc_checker_t* checker, const tc_journal_config_t* config) {
+    if (!config || !config->directory) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        JournalConfig cpp_config;
+        cpp_config.directory = config->directory;
+        if (config->prefix) {
+            cpp_config.prefix = config->prefix;
+        }
+        if (config->segment_bytes > 0) {
+            cpp_config.segmentBytes = config->segment_bytes;
+        }
+        cpp_config.maxSegments = config->max_segments;
+        cpp_config.recordSamples = config->record_samples != 0;
+        
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        return cpp_checker.enableJournal(cpp_config) ? TC_SUCCESS : TC_ERROR_GENERAL;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_disable_journal(tc_checker_t* checker) {
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        cpp_checker.disableJournal();
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_journal_stats(tc_checker_t* checker, tc_journal_stats_t* stats) {
+    if (!stats) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        JournalStats cpp_stats = cpp_checker.getJournalStats();
+        stats->enabled = cpp_stats.enabled ? 1 : 0;
+        stats->records = cpp_stats.records;
+        stats->bytes = cpp_stats.bytes;
+        stats->segments = cpp_stats.segments;
+        stats->dropped = cpp_stats.dropped;
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_set_transition_batch_callback(tc_checker_t* checker, tc_transition_batch_callback_t callback,
+                                             const tc_batch_config_t* config, void* ctx) {
+    try {
+        BatchConfig cpp_config;
+        if (config) {
+            if (config->max_batch > 0) {
+                cpp_config.maxBatch = config->max_batch;
+            }
+            cpp_config.maxLatencyMs = config->max_latency_ms;
+            if (config->queue_capacity > 0) {
+                cpp_config.queueCapacity = config->queue_capacity;
+            }
+            cpp_config.policy = config->overflow_policy == TC_OVERFLOW_BLOCK ? OverflowPolicy::BLOCK
+                                                                             : OverflowPolicy::DROP;
+        }
+        
+        TransitionBatchCallback cpp_callback;
+        if (callback) {
+            cpp_callback = [callback, ctx](const TransitionEvent* events, std::size_t count) {
+                // 回调只在交付线程上调用，转换缓冲区按线程复用
+                thread_local std::vector<tc_transition_event_t> c_events;
+                c_events.resize(count);
+                for (std::size_t i = 0; i < count; ++i) {
+                    convert_transition(events[i], &c_events[i]);
+                }
+                callback(c_events.data(), count, ctx);
+            };
+        }
+        
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        return cpp_checker.setTransitionBatchSink(std::move(cpp_callback), cpp_config) ? TC_SUCCESS
+                                                                                        : TC_ERROR_GENERAL;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_checker_get_transition_batch_stats(tc_checker_t* checker, tc_batch_stats_t* stats) {
+    if (!stats) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        ToleranceChecker& cpp_checker = resolve_checker(checker);
+        BatchStats cpp_stats = cpp_checker.getTransitionBatchStats();
+        stats->enabled = cpp_stats.enabled ? 1 : 0;
+        stats->batches = cpp_stats.batches;
+        stats->events = cpp_stats.events;
+        stats->largest_batch = cpp_stats.largestBatch;
+        stats->dropped = cpp_stats.dropped;
+        stats->blocked = cpp_stats.blocked;
+        stats->exceptions = cpp_stats.exceptions;
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+static KernelSignalConfig convert_kernel_signal(const tc_kernel_signal_t* signal) {
+    KernelSignalConfig cpp_config;
+    cpp_config.targetValue = signal->target_value;
+    cpp_config.warningThreshold = signal->warning_threshold;
+    cpp_config.faultThreshold = signal->fault_threshold;
+    cpp_config.tc = signal->tc;
+    cpp_config.ts = signal->ts;
+    return cpp_config;
+}
+
+tc_kernel_t* tc_kernel_create(const tc_kernel_signal_t* signals, size_t count, long long now) {
+    if (count > 0 && !signals) {
+        return nullptr;
+    }
+    
+    try {
+        auto* kernel = new tc_kernel();
+        for (size_t i = 0; i < count; ++i) {
+            kernel->kernel.addSignal(convert_kernel_signal(&signals[i]), now);
+        }
+        return kernel;
+        
+    } catch (const std::exception& e) {
+        return nullptr;
+    }
+}
+
+void tc_kernel_destroy(tc_kernel_t* kernel) {
+    delete kernel;
+}
+
+int tc_kernel_add_signal(tc_kernel_t* kernel, const tc_kernel_signal_t* signal, long long now, size_t* index) {
+    if (!kernel || !signal) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    try {
+        size_t added = kernel->kernel.addSignal(convert_kernel_signal(signal), now);
+        if (index) {
+            *index = added;
+        }
+        return TC_SUCCESS;
+        
+    } catch (const std::exception& e) {
+        return TC_ERROR_GENERAL;
+    }
+}
+
+int tc_kernel_configure(tc_kernel_t* kernel, size_t index, const tc_kernel_signal_t* signal, long long now) {
+    if (!kernel || !signal) {
+        return TC_ERROR_NULL_PTR;
+    }
+    return kernel->kernel.configure(index, convert_kernel_signal(signal), now) ? TC_SUCCESS : TC_ERROR_NOT_FOUND;
+}
+
+int tc_kernel_evaluate(tc_kernel_t* kernel, const double* values, size_t count, long long now,
+                       tc_signal_state_t* states, size_t* changed) {
+    if (!kernel || (count > 0 && !values)) {
+        return TC_ERROR_NULL_PTR;
+    }
+    
+    size_t transitions = kernel->kernel.evaluate(values, count, now, nullptr);
+    if (states) {
+        // 状态取值与SignalState一致，直接由内核的状态数组转换
+        const std::uint8_t* cpp_states = kernel->kernel.states();
+        size_t evaluated = count < kernel->kernel.size() ? count : kernel->kernel.size();
+        for (size_t i = 0; i < evaluated; ++i) {
+            states[i] = static_cast<tc_signal_state_t>(cpp_states[i]);
+        }
+    }
+    if (changed) {
+        *changed = transitions;
+    }
+    return TC_SUCCESS;
+}
+
+// 默认实例接口
+
+int tc_register_signal(const char* signal_id, const tc_signal_config_t* config) {
+    return tc_checker_register_signal(nullptr, signal_id, config);
+}
+
+int tc_register_signal_with_handle(const char* signal_id, const tc_signal_config_t* config, tc_handle_t* handle) {
+    return tc_checker_register_signal_with_handle(nullptr, signal_id, config, handle);
+}
+
+int tc_register_signals(const char* const* signal_ids, const tc_signal_config_t* configs, size_t count,
+                        tc_handle_t* handles, size_t* registered) {
+    return tc_checker_register_signals(nullptr, signal_ids, configs, count, handles, registered);
+}
+
+int tc_find_signal(const char* signal_id, tc_handle_t* handle) {
+    return tc_checker_find_signal(nullptr, signal_id, handle);
+}
+
+int tc_register_signal_group(const char* group_id, tc_batch_value_callback_t callback, void* ctx) {
+    return tc_checker_register_signal_group(nullptr, group_id, callback, ctx);
+}
+
+int tc_remove_signal_group(const char* group_id) {
+    return tc_checker_remove_signal_group(nullptr, group_id);
+}
+
+int tc_stop_monitoring(void) {
+    return tc_checker_stop_monitoring(nullptr);
+}
+
+int tc_is_monitoring(void) {
+    return tc_checker_is_monitoring(nullptr);
+}
+
+int tc_remove_signal(const char* signal_id) {
+    return tc_checker_remove_signal(nullptr, signal_id);
+}
+
+int tc_remove_signal_by_handle(tc_handle_t handle) {
+    return tc_checker_remove_signal_by_handle(nullptr, handle);
+}
+
+int tc_remove_signals(const tc_handle_t* handles, size_t count, size_t* removed) {
+    return tc_checker_remove_signals(nullptr, handles, count, removed);
+}
+
+int tc_get_signal_state(const char* signal_id, tc_signal_state_t* state) {
+    return tc_checker_get_signal_state(nullptr, signal_id, state);
+}
+
+int tc_get_signal_state_by_handle(tc_handle_t handle, tc_signal_state_t* state) {
+    return tc_checker_get_signal_state_by_handle(nullptr, handle, state);
+}
+
+int tc_get_signal_states(tc_signal_status_t* states, size_t capacity, size_t* count) {
+    return tc_checker_get_signal_states(nullptr, states, capacity, count);
+}
+
+int tc_get_signal_states_by_handle(const tc_handle_t* handles, size_t count, tc_signal_status_t* states) {
+    return tc_checker_get_signal_states_by_handle(nullptr, handles, count, states);
+}
+
+int tc_export_sample_history(tc_handle_t handle, tc_history_sample_t* samples, size_t capacity, size_t* count) {
+    return tc_checker_export_sample_history(nullptr, handle, samples, capacity, count);
+}
+
+int tc_set_history_memory_limit(size_t bytes) {
+    return tc_checker_set_history_memory_limit(nullptr, bytes);
+}
+
+int tc_get_history_memory(tc_history_memory_t* usage) {
+    return tc_checker_get_history_memory(nullptr, usage);
+}
+
+int tc_push_value(const char* signal_id, double value, long long timestamp_ns, tc_push_mode_t mode) {
+    return tc_checker_push_value(nullptr, signal_id, value, timestamp_ns, mode);
+}
+
+int tc_push_value_by_handle(tc_handle_t handle, double value, long long timestamp_ns, tc_push_mode_t mode) {
+    return tc_checker_push_value_by_handle(nullptr, handle, value, timestamp_ns, mode);
+}
+
+int tc_configure_sharding(unsigned worker_count, unsigned shard_count) {
+    return tc_checker_configure_sharding(nullptr, worker_count, shard_count);
+}
+
+int tc_get_shard_stats(tc_shard_stats_t* stats, int capacity, int* count) {
+    return tc_checker_get_shard_stats(nullptr, stats, capacity, count);
+}
+
+int tc_configure_dispatch(unsigned thread_count, unsigned queue_capacity, tc_overflow_policy_t policy) {
+    return tc_checker_configure_dispatch(nullptr, thread_count, queue_capacity, policy);
+}
+
+int tc_get_dispatch_stats(tc_dispatch_stats_t* stats) {
+    return tc_checker_get_dispatch_stats(nullptr, stats);
+}
+
+int tc_set_overrun_policy(tc_overrun_policy_t policy) {
+    return tc_checker_set_overrun_policy(nullptr, policy);
+}
+
+int tc_get_loop_stats(tc_loop_stats_t* stats) {
+    return tc_checker_get_loop_stats(nullptr, stats);
+}
+
+int tc_enable_stats(int enabled) {
+    return tc_checker_enable_stats(nullptr, enabled);
+}
+
+int tc_get_stats(tc_stats_t* stats) {
+    return tc_checker_get_stats(nullptr, stats);
+}
+
+int tc_get_signal_stats(tc_handle_t handle, tc_signal_stats_t* stats) {
+    return tc_checker_get_signal_stats(nullptr, handle, stats);
+}
+
+int tc_enable_transition_stream(size_t capacity) {
+    return tc_checker_enable_transition_stream(nullptr, capacity);
+}
+
+int tc_subscribe_transitions(unsigned long long* cursor) {
+    return tc_checker_subscribe_transitions(nullptr, cursor);
+}
+
+int tc_read_transitions(unsigned long long* cursor, tc_transition_event_t* events, size_t capacity, size_t* count) {
+    return tc_checker_read_transitions(nullptr, cursor, events, capacity, count);
+}
+
+int tc_resync_transitions(unsigned long long* cursor, tc_signal_status_t* states, size_t capacity, size_t* count) {
+    return tc_checker_resync_transitions(nullptr, cursor, states, capacity, count);
+}
+
+int tc_enable_journal(const tc_journal_config_t* config) {
+    return tc_checker_enable_journal(nullptr, config);
+}
+
+int tc_disable_journal(void) {
+    return tc_checker_disable_journal(nullptr);
+}
+
+int tc_get_journal_stats(tc_journal_stats_t* stats) {
+    return tc_checker_get_journal_stats(nullptr, stats);
+}
+
+int tc_set_transition_batch_callback(tc_transition_batch_callback_t callback, const tc_batch_config_t* config,
+                                     void* ctx) {
+    return tc_checker_set_transition_batch_callback(nullptr, callback, config, ctx);
+}
+
+int tc_get_transition_batch_stats(tc_batch_stats_t* stats) {
+    return tc_checker_get_transition_batch_stats(nullptr, stats);
+}
+
 const char* tc_get_state_name(tc_signal_state_t state) {
     switch (state) {
         case TC_SIGNAL_UNKNOWN: return "UNKNOWN";
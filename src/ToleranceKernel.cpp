@@ -0,0 +1,103 @@
+#include "ToleranceKernel.h"
+#include "SignalHotStore.h"
+#include <algorithm>
+
+namespace {
+
+constexpr std::uint8_t kUnknown = static_cast<std::uint8_t>(SignalState::UNKNOWN);
+constexpr std::uint8_t kNormal = static_cast<std::uint8_t>(SignalState::NORMAL);
+constexpr std::uint8_t kWarning = static_cast<std::uint8_t>(SignalState::WARNING);
+constexpr std::uint8_t kFault = static_cast<std::uint8_t>(SignalState::FAULT);
+
+} // namespace
+
+ToleranceKernel::ToleranceKernel(const KernelSignalConfig* configs, std::size_t count, TickTime now) {
+    m_targets.reserve(count);
+    m_warningThresholds.reserve(count);
+    m_faultThresholds.reserve(count);
+    m_settleTimes.reserve(count);
+    m_ts.reserve(count);
+    m_warningSince.reserve(count);
+    m_faultSince.reserve(count);
+    m_states.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        addSignal(configs[i], now);
+    }
+}
+
+std::size_t ToleranceKernel::addSignal(const KernelSignalConfig& config, TickTime now) {
+    const std::size_t index = m_targets.size();
+    m_targets.push_back(0.0);
+    m_warningThresholds.push_back(0.0);
+    m_faultThresholds.push_back(0.0);
+    m_settleTimes.push_back(0);
+    m_ts.push_back(0);
+    m_warningSince.push_back(kInactive);
+    m_faultSince.push_back(kInactive);
+    m_states.push_back(kUnknown);
+    configure(index, config, now);
+    return index;
+}
+
+bool ToleranceKernel::configure(std::size_t index, const KernelSignalConfig& config, TickTime now) {
+    if (index >= m_targets.size()) {
+        return false;
+    }
+    m_targets[index] = config.targetValue;
+    m_warningThresholds[index] = config.warningThreshold;
+    m_faultThresholds[index] = config.faultThreshold;
+    m_settleTimes[index] = now + std::max<TickTime>(config.tc, 0);
+    m_ts[index] = std::max<TickTime>(config.ts, 0);
+    m_warningSince[index] = kInactive;
+    m_faultSince[index] = kInactive;
+    m_states[index] = kUnknown;
+    return true;
+}
+
+std::size_t ToleranceKernel::evaluate(const double* values, std::size_t count, TickTime now, SignalState* out) {
+    count = std::min(count, m_targets.size());
+    std::size_t changed = 0;
+    for (std::size_t base = 0; base < count; base += kChunk) {
+        const std::size_t chunk = std::min(kChunk, count - base);
+        SignalHotStore::classifyContiguous(values + base, m_targets.data() + base, m_warningThresholds.data() + base,
+                                           m_faultThresholds.data() + base, m_bands, chunk);
+
+        // 去抖：与ToleranceChecker::updateSignalState相同的状态机，以条件选择代替分支
+        TickTime* warningSince = m_warningSince.data() + base;
+        TickTime* faultSince = m_faultSince.data() + base;
+        const TickTime* settleTimes = m_settleTimes.data() + base;
+        const TickTime* ts = m_ts.data() + base;
+        std::uint8_t* states = m_states.data() + base;
+        for (std::size_t j = 0; j < chunk; ++j) {
+            const std::uint8_t previous = states[j];
+            const std::uint8_t band = m_bands[j];
+            const bool active = now >= settleTimes[j];  // tc等待期内的样本不参与评估
+            const bool normal = band == kNormal;
+            const bool warning = band == kWarning;
+            const bool fault = band == kFault;
+
+            TickTime warningStart = warningSince[j];
+            TickTime faultStart = faultSince[j];
+            warningStart = normal ? kInactive : (warning && warningStart == kInactive ? now : warningStart);
+            faultStart = fault ? (faultStart == kInactive ? now : faultStart) : kInactive;
+
+            // 计时开始时间<=now-ts即已持续ts；未开始的计时为kInactive，不会满足
+            const TickTime deadline = now - ts[j];
+            std::uint8_t current = normal ? kNormal : previous;
+            current = warning && warningStart <= deadline ? kWarning : current;
+            current = fault && faultStart <= deadline ? kFault : current;
+
+            warningSince[j] = active ? warningStart : warningSince[j];
+            faultSince[j] = active ? faultStart : faultSince[j];
+            current = active ? current : previous;
+            states[j] = current;
+            changed += current != previous;
+        }
+        if (out) {
+            for (std::size_t j = 0; j < chunk; ++j) {
+                out[base + j] = static_cast<SignalState>(states[j]);
+            }
+        }
+    }
+    return changed;
+}
@@ -0,0 +1,131 @@
+#include "WorkerPool.h"
+#include "ThreadAffinity.h"
+
+WorkerPool::WorkerPool(unsigned workerCount) {
+    if (workerCount == 0) {
+        workerCount = 1;
+    }
+    for (unsigned i = 0; i < workerCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t i = 0; i < m_workers.size(); ++i) {
+        m_threads.emplace_back(&WorkerPool::workerLoop, this, i);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    for (auto& thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+bool WorkerPool::setAffinity(const std::vector<unsigned>& cpus) {
+    bool succeeded = true;
+    for (auto& thread : m_threads) {
+        succeeded = setThreadAffinity(thread.native_handle(), cpus) && succeeded;
+    }
+    return succeeded;
+}
+
+bool WorkerPool::setScheduling(SchedulingPolicy policy, int priority) {
+    bool succeeded = true;
+    for (auto& thread : m_threads) {
+        succeeded = setThreadScheduling(thread.native_handle(), policy, priority) == 0 && succeeded;
+    }
+    return succeeded;
+}
+
+void WorkerPool::run(std::vector<Task>& tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+
+    m_pending.store(tasks.size());
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        Worker& worker = *m_workers[i % m_workers.size()];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.queue.push_back(&tasks[i]);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_generation;
+    }
+    m_workAvailable.notify_all();
+
+    // 调用线程参与窃取，避免在工作线程全部忙碌时空等
+    while (Task* task = steal(m_workers.size())) {
+        execute(task);
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_batchDone.wait(lock, [this] { return m_pending.load() == 0; });
+}
+
+WorkerPool::Task* WorkerPool::popLocal(std::size_t index) {
+    Worker& worker = *m_workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.queue.empty()) {
+        return nullptr;
+    }
+    Task* task = worker.queue.front();
+    worker.queue.pop_front();
+    return task;
+}
+
+WorkerPool::Task* WorkerPool::steal(std::size_t thief) {
+    const std::size_t count = m_workers.size();
+    for (std::size_t offset = 1; offset <= count; ++offset) {
+        const std::size_t victim = (thief + offset) % count;
+        if (victim == thief) {
+            continue;
+        }
+        Worker& worker = *m_workers[victim];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.queue.empty()) {
+            Task* task = worker.queue.back();
+            worker.queue.pop_back();
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void WorkerPool::execute(Task* task) {
+    (*task)();
+    if (m_pending.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_batchDone.notify_all();
+    }
+}
+
+void WorkerPool::workerLoop(std::size_t index) {
+    std::uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workAvailable.wait(lock, [&] { return m_stopping || m_generation != seenGeneration; });
+            if (m_stopping) {
+                return;
+            }
+            seenGeneration = m_generation;
+        }
+
+        while (true) {
+            Task* task = popLocal(index);
+            if (!task) {
+                task = steal(index);
+            }
+            if (!task) {
+                break;
+            }
+            execute(task);
+        }
+    }
+}
@@ -121,7 +121,9 @@ int main(void) {
     int result;
     
     // 1. 配置温度传感器
+    // 先初始化，未设置的字段取默认值：不分组、不使用共享内存、不保存样本历史、无滞回
     tc_signal_config_t temp_config;
+    tc_signal_config_init(&temp_config);
     temp_config.target_value = g_temperature_sensor.target_value;
     temp_config.warning_threshold = g_temperature_sensor.warning_threshold;
     temp_config.fault_threshold = g_temperature_sensor.fault_threshold;
@@ -131,9 +133,11 @@ int main(void) {
     temp_config.context = &g_temperature_sensor;  // 传递传感器上下文
     temp_config.tc_ms = 1000;                     // 等待1秒开始监控
     temp_config.ts_ms = 2000;                     // 持续2秒后触发回调
+    temp_config.sample_period_ms = 500;           // 温度变化慢，每500毫秒采样一次
     
     // 2. 配置压力传感器
     tc_signal_config_t pressure_config;
+    tc_signal_config_init(&pressure_config);
     pressure_config.target_value = g_pressure_sensor.target_value;
     pressure_config.warning_threshold = g_pressure_sensor.warning_threshold;
     pressure_config.fault_threshold = g_pressure_sensor.fault_threshold;
@@ -143,6 +147,10 @@ int main(void) {
     pressure_config.context = &g_pressure_sensor;  // 传递传感器上下文
     pressure_config.tc_ms = 1000;                  // 等待1秒开始监控
     pressure_config.ts_ms = 2000;                  // 持续2秒后触发回调
+    pressure_config.sample_period_ms = 100;        // 每100毫秒采样一次
+    
+    // 回调交由独立派发线程执行，队列满时阻塞以保证不丢事件
+    tc_configure_dispatch(1, 256, TC_OVERFLOW_BLOCK);
     
     // 3. 注册信号
     printf("\n[C Demo] 注册温度传感器...\n");
@@ -3,19 +3,15 @@
 #include <thread>
 #include <chrono>
 
-// 全局变量存储传感器数据
+// 全局变量存储传感器数据（压力信号改为推送，无需全局变量）
 double g_temperature = 20.0;
-double g_pressure = 1000.0;
+SignalHandle g_pressureHandle;  // 压力信号句柄，推送时无需字符串查找
 
 // 信号值回调函数
 double getTemperatureValue(const std::string& signalId) {
     return g_temperature;
 }
 
-double getPressureValue(const std::string& signalId) {
-    return g_pressure;
-}
-
 // 警告和故障回调函数
 void onTemperatureWarning(const std::string& signalId, double value) {
     std::cout << "🟡 温度警告！信号: " << signalId << ", 当前值: " << value << "°C" << std::endl;
@@ -74,7 +70,8 @@ void simulatePressureSensor() {
     
     for (size_t i = 0; i < pressures.size(); ++i) {
         std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        g_pressure = pressures[i];  // 直接更新全局变量
+        // 样本到手即推送，立即评估
+        ToleranceChecker::getInstance().pushValue(g_pressureHandle, pressures[i]);
         std::cout << "压力传感器更新: " << pressures[i] << " Pa" << std::endl;
     }
 }
@@ -84,6 +81,9 @@ int main() {
     std::cout << std::endl;
     
     auto& checker = ToleranceChecker::getInstance();
+    checker.configureSharding(2);  // 2个工作线程并行检查
+    checker.configureDispatch(1);  // 回调由独立派发线程执行
+    checker.enableStats(true);     // 记录热点路径统计
     
     // 注册温度传感器信号
     SignalConfig tempConfig;
@@ -95,6 +95,7 @@ int main() {
     tempConfig.valueCallback = getTemperatureValue;  // 添加值获取回调
     tempConfig.tcMs = 1000;  // 等待1秒后开始监控
     tempConfig.tsMs = 2000;  // 持续2秒后触发回调
+    tempConfig.samplePeriodMs = 500;  // 温度变化慢，每500毫秒采样一次
     
     checker.registerSignal("temperature_sensor", tempConfig);
     
@@ -105,11 +106,12 @@ int main() {
     pressureConfig.faultThreshold = 600.0;     // 偏差±600Pa触发故障
     pressureConfig.warningCallback = onPressureWarning;
     pressureConfig.faultCallback = onPressureFault;
-    pressureConfig.valueCallback = getPressureValue;  // 添加值获取回调
+    pressureConfig.valueCallback = nullptr;    // 推送模式，不需要值获取回调
     pressureConfig.tcMs = 1500;  // 等待1.5秒后开始监控
     pressureConfig.tsMs = 1500;  // 持续1.5秒后触发回调
+    pressureConfig.samplePeriodMs = 50;  // 每50毫秒用最近的推送值推进计时
     
-    checker.registerSignal("pressure_sensor", pressureConfig);
+    g_pressureHandle = checker.registerSignal("pressure_sensor", pressureConfig);
     
     std::cout << std::endl;
     std::cout << "开始传感器数据模拟..." << std::endl;
@@ -128,6 +130,32 @@ int main() {
     // 等待一段时间让所有回调触发
     std::this_thread::sleep_for(std::chrono::seconds(3));
     
+    // 输出分片统计
+    auto shardStats = checker.getShardStats();
+    for (size_t i = 0; i < shardStats.size(); ++i) {
+        const auto& stats = shardStats[i];
+        if (stats.passes == 0) continue;
+        std::cout << "分片 " << i << ": 信号 " << stats.signalCount
+                  << "，检查 " << stats.checks
+                  << "，平均耗时 " << stats.totalPassUs / stats.passes << "us"
+                  << "，最大滞后 " << stats.maxLatenessUs << "us" << std::endl;
+    }
+    
+    // 输出循环抖动与超期统计
+    auto loopStats = checker.getLoopStats();
+    std::cout << "监控循环: " << loopStats.iterations << " 轮"
+              << "，平均抖动 " << (loopStats.timedWakeups ? loopStats.totalJitterUs / loopStats.timedWakeups : 0) << "us"
+              << "，最大抖动 " << loopStats.maxJitterUs << "us"
+              << "，超期 " << loopStats.overruns << " 次"
+              << "，最大滞后 " << loopStats.worstLatenessUs << "us" << std::endl;
+    
+    // 输出热点路径统计
+    auto stats = checker.getStats();
+    std::cout << "检查耗时: p50 " << stats.passLatency.p50Ns << "ns，p99 " << stats.passLatency.p99Ns
+              << "ns，最大 " << stats.passLatency.maxNs << "ns" << std::endl;
+    std::cout << "状态迁移: 警告 " << stats.warningTransitions << " 次，故障 " << stats.faultTransitions
+              << " 次，恢复 " << stats.recoveries << " 次，取值失败 " << stats.valueErrors << " 次" << std::endl;
+    
     // 停止监控
     checker.stopMonitoring();
     
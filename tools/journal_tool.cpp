@@ -0,0 +1,230 @@
+/**
+ * @file journal_tool.cpp
+ * @brief 事件日志扫描与过滤工具
+ *
+ * 顺序扫描一个或多个事件日志段文件（或目录中按序号排列的全部段文件），
+ * 按信号、记录类型、迁移后状态与墙上时间过滤，输出文本或只输出计数，用于事后分析。
+ *
+ * 用法: ToleranceJournalTool [选项] <目录|段文件>...
+ *   --prefix P      目录中段文件的前缀（默认journal）
+ *   --signal ID     只输出指定信号（可重复）
+ *   --type T        只输出指定类型：transition、sample、signal（可重复）
+ *   --state S       只输出迁移到指定状态的记录：UNKNOWN、NORMAL、WARNING、FAULT（可重复，隐含--type transition）
+ *   --since SEC     只输出不早于该时间的记录（Unix纪元秒，可带小数）
+ *   --until SEC     只输出早于该时间的记录（Unix纪元秒，可带小数）
+ *   --count         只输出各类型的记录数
+ *   --stats         扫描结束后向标准错误输出扫描速度
+ */
+
+#include "JournalReader.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/stat.h>
+
+namespace {
+
+const char* const kStateNames[] = {"UNKNOWN", "NORMAL", "WARNING", "FAULT"};
+
+struct Options {
+    std::string prefix{"journal"};            ///< 段文件前缀
+    std::vector<std::string> inputs;          ///< 目录或段文件
+    std::unordered_set<std::string> signals;  ///< 需要输出的信号ID
+    std::uint32_t typeMask{0};                ///< 需要输出的记录类型，0表示全部
+    std::uint32_t stateMask{0};               ///< 需要输出的迁移后状态，0表示全部
+    double since{-1.0};                       ///< 起始墙上时间（秒），<0表示不限
+    double until{-1.0};                       ///< 结束墙上时间（秒），<0表示不限
+    bool countOnly{false};                    ///< 只输出计数
+    bool stats{false};                        ///< 输出扫描速度
+};
+
+int usage() {
+    std::fprintf(stderr,
+                 "用法: ToleranceJournalTool [--prefix P] [--signal ID]... [--type transition|sample|signal]...\n"
+                 "       [--state UNKNOWN|NORMAL|WARNING|FAULT]... [--since SEC] [--until SEC] [--count] [--stats]\n"
+                 "       <目录|段文件>...\n");
+    return 2;
+}
+
+bool parseState(const char* name, std::uint32_t& mask) {
+    for (unsigned i = 0; i < 4; ++i) {
+        if (std::strcmp(name, kStateNames[i]) == 0) {
+            mask |= 1u << i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parseType(const char* name, std::uint32_t& mask) {
+    if (std::strcmp(name, "transition") == 0) {
+        mask |= 1u << static_cast<unsigned>(JournalRecordType::TRANSITION);
+    } else if (std::strcmp(name, "sample") == 0) {
+        mask |= 1u << static_cast<unsigned>(JournalRecordType::SAMPLE);
+    } else if (std::strcmp(name, "signal") == 0) {
+        mask |= 1u << static_cast<unsigned>(JournalRecordType::SIGNAL);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool isDirectory(const std::string& path) {
+    struct stat info{};
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+// 墙上时间格式化为"YYYY-MM-DD HH:MM:SS.mmm"
+void formatWallTime(std::int64_t wallNs, char* buffer, std::size_t size) {
+    const std::time_t seconds = static_cast<std::time_t>(wallNs / 1000000000);
+    const int millis = static_cast<int>((wallNs % 1000000000) / 1000000);
+    std::tm local{};
+    localtime_r(&seconds, &local);
+    std::size_t length = std::strftime(buffer, size, "%Y-%m-%d %H:%M:%S", &local);
+    std::snprintf(buffer + length, size - length, ".%03d", millis);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--prefix") == 0 && hasValue) {
+            options.prefix = argv[++i];
+        } else if (std::strcmp(arg, "--signal") == 0 && hasValue) {
+            options.signals.insert(argv[++i]);
+        } else if (std::strcmp(arg, "--type") == 0 && hasValue) {
+            if (!parseType(argv[++i], options.typeMask)) {
+                return usage();
+            }
+        } else if (std::strcmp(arg, "--state") == 0 && hasValue) {
+            if (!parseState(argv[++i], options.stateMask)) {
+                return usage();
+            }
+        } else if (std::strcmp(arg, "--since") == 0 && hasValue) {
+            options.since = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--until") == 0 && hasValue) {
+            options.until = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--count") == 0) {
+            options.countOnly = true;
+        } else if (std::strcmp(arg, "--stats") == 0) {
+            options.stats = true;
+        } else if (arg[0] == '-') {
+            return usage();
+        } else {
+            options.inputs.push_back(arg);
+        }
+    }
+    if (options.inputs.empty()) {
+        return usage();
+    }
+
+    std::vector<std::string> files;
+    for (const auto& input : options.inputs) {
+        if (isDirectory(input)) {
+            for (const auto& segment : JournalReader::listSegments(input, options.prefix)) {
+                files.push_back(segment.path);
+            }
+        } else {
+            files.push_back(input);
+        }
+    }
+
+    JournalFilter filter;
+    if (options.typeMask != 0) {
+        filter.typeMask = options.typeMask;
+    }
+    if (options.stateMask != 0) {
+        // 状态条件只对迁移记录有意义，未指定类型时只输出迁移
+        filter.newStateMask = options.stateMask;
+        if (options.typeMask == 0) {
+            filter.typeMask = 1u << static_cast<unsigned>(JournalRecordType::TRANSITION);
+        }
+    }
+    // 按ID过滤时，句柄在扫描到信号记录后才知道；0不是有效句柄，先放入使过滤生效
+    if (!options.signals.empty()) {
+        filter.handles.insert(0);
+    }
+
+    static char outputBuffer[1 << 20];
+    std::setvbuf(stdout, outputBuffer, _IOFBF, sizeof(outputBuffer));
+
+    std::unordered_map<std::uint64_t, std::string> names;
+    std::uint64_t scanned = 0;
+    std::uint64_t counts[4] = {};
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& file : files) {
+        auto reader = JournalReader::open(file);
+        if (!reader) {
+            std::fprintf(stderr, "无法读取日志段文件 %s: %s\n", file.c_str(), std::strerror(errno));
+            continue;
+        }
+        // 墙上时间范围按本段的时钟对应关系换算为steady_clock时间
+        const JournalFileHeader& header = reader->header();
+        filter.fromNs = options.since < 0 ? INT64_MIN
+            : static_cast<std::int64_t>(options.since * 1e9) - header.wallOriginNs + header.steadyOriginNs;
+        filter.toNs = options.until < 0 ? INT64_MAX
+            : static_cast<std::int64_t>(options.until * 1e9) - header.wallOriginNs + header.steadyOriginNs;
+
+        JournalEvent event;
+        while (reader->next(event)) {
+            ++scanned;
+            if (event.type == JournalRecordType::SIGNAL) {
+                std::string id(event.signalId, event.signalIdLength);
+                if (options.signals.count(id)) {
+                    filter.handles.insert(event.handle);
+                }
+                names[event.handle] = std::move(id);
+            }
+            if (!filter.matches(event)) {
+                continue;
+            }
+            ++counts[static_cast<unsigned>(event.type) & 3];
+            if (options.countOnly) {
+                continue;
+            }
+
+            auto name = names.find(event.handle);
+            const char* signalId = name != names.end() ? name->second.c_str() : "?";
+            if (event.type == JournalRecordType::SIGNAL) {
+                std::printf("-                       SIGNAL     %s handle=%llu\n", signalId,
+                            static_cast<unsigned long long>(event.handle));
+                continue;
+            }
+            char wallTime[40];
+            formatWallTime(reader->toWallNs(event.timestampNs), wallTime, sizeof(wallTime));
+            if (event.type == JournalRecordType::TRANSITION) {
+                std::printf("%s TRANSITION %s %s -> %s value=%.17g\n", wallTime, signalId,
+                            kStateNames[event.oldState & 3], kStateNames[event.newState & 3], event.value);
+            } else {
+                std::printf("%s SAMPLE     %s value=%.17g\n", wallTime, signalId, event.value);
+            }
+        }
+    }
+    std::fflush(stdout);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (options.countOnly) {
+        std::printf("signal %llu\ntransition %llu\nsample %llu\n",
+                    static_cast<unsigned long long>(counts[static_cast<unsigned>(JournalRecordType::SIGNAL)]),
+                    static_cast<unsigned long long>(counts[static_cast<unsigned>(JournalRecordType::TRANSITION)]),
+                    static_cast<unsigned long long>(counts[static_cast<unsigned>(JournalRecordType::SAMPLE)]));
+        std::fflush(stdout);
+    }
+    if (options.stats) {
+        std::fprintf(stderr, "扫描 %zu 个段文件，%llu 条记录，耗时 %.3fs（%.1f M条/秒）\n", files.size(),
+                     static_cast<unsigned long long>(scanned), seconds, seconds > 0 ? scanned / seconds / 1e6 : 0.0);
+    }
+    return 0;
+}